@@ -0,0 +1,80 @@
+#include "benchmark/bloom_filter_benchmarks.hpp"
+#include "benchmark/dyn_matrix_benchmarks.hpp"
+#include "benchmark/dynamic_array_benchmarks.hpp"
+#include "benchmark/linked_list_benchmarks.hpp"
+#include "benchmark/lru_benchmarks.hpp"
+#include "benchmark/matrix_benchmarks.hpp"
+#include "benchmark/multi_queue_benchmarks.hpp"
+#include "benchmark/priority_queue_benchmarks.hpp"
+#include "benchmark/queue_stack_benchmarks.hpp"
+#include "benchmark/ring_buffer_benchmarks.hpp"
+#include "benchmark/search_tree_benchmarks.hpp"
+#include "benchmark/sharded_lru_benchmarks.hpp"
+#include "benchmark/simd_search_benchmarks.hpp"
+#include "benchmark/string_benchmarks.hpp"
+#include "benchmark/top_k_benchmarks.hpp"
+#include "benchmark/treap_benchmarks.hpp"
+#include "benchmark/tree_allocator_benchmarks.hpp"
+
+#include "benchmark/benchmark_manager.hpp"
+
+void do_benchmark() {
+  pxd::BenchmarkManager benchmark_manager;
+
+  pxd::BloomFilterBenchmarks bloom_filter_benchmarks;
+  pxd::DynMatrixBenchmarks dyn_matrix_benchmarks;
+  pxd::DynamicArrayBenchmarks dynamic_array_benchmarks;
+  pxd::LinkedListBenchmarks linked_list_benchmarks;
+  pxd::LRUCacheBenchmarks lru_cache_benchmarks;
+  pxd::MatrixBenchmarks matrix_benchmarks;
+  pxd::MultiQueueBenchmarks multi_queue_benchmarks;
+  pxd::PriorityQueueBenchmarks priority_queue_benchmarks;
+  pxd::QueueStackBenchmarks queue_stack_benchmarks;
+  pxd::RingBufferBenchmarks ring_buffer_benchmarks;
+  pxd::SearchTreeBenchmarks search_tree_benchmarks;
+  pxd::ShardedLRUCacheBenchmarks sharded_lru_cache_benchmarks;
+  pxd::SIMDSearchBenchmarks simd_search_benchmarks;
+  pxd::StringBenchmarks string_benchmarks;
+  pxd::TopKBenchmarks top_k_benchmarks;
+  pxd::TreapBenchmarks treap_benchmarks;
+  pxd::TreeAllocatorBenchmarks tree_allocator_benchmarks;
+
+  benchmark_manager.add_benchmark("Bloom Filter Benchmarks",
+                                  bloom_filter_benchmarks);
+  benchmark_manager.add_benchmark("Dyn Matrix Benchmarks",
+                                  dyn_matrix_benchmarks);
+  benchmark_manager.add_benchmark("Dynamic Array Benchmarks",
+                                  dynamic_array_benchmarks);
+  benchmark_manager.add_benchmark("Linked List Benchmarks",
+                                  linked_list_benchmarks);
+  benchmark_manager.add_benchmark("LRU Cache Benchmarks", lru_cache_benchmarks);
+  benchmark_manager.add_benchmark("Matrix Benchmarks", matrix_benchmarks);
+  benchmark_manager.add_benchmark("Multi Queue Benchmarks",
+                                  multi_queue_benchmarks);
+  benchmark_manager.add_benchmark("Priority Queue Benchmarks",
+                                  priority_queue_benchmarks);
+  benchmark_manager.add_benchmark("Queue Stack Benchmarks",
+                                  queue_stack_benchmarks);
+  benchmark_manager.add_benchmark("Ring Buffer Benchmarks",
+                                  ring_buffer_benchmarks);
+  benchmark_manager.add_benchmark("Search Tree Benchmarks",
+                                  search_tree_benchmarks);
+  benchmark_manager.add_benchmark("Sharded LRU Cache Benchmarks",
+                                  sharded_lru_cache_benchmarks);
+  benchmark_manager.add_benchmark("SIMD Search Benchmarks",
+                                  simd_search_benchmarks);
+  benchmark_manager.add_benchmark("String Benchmarks", string_benchmarks);
+  benchmark_manager.add_benchmark("Top K Benchmarks", top_k_benchmarks);
+  benchmark_manager.add_benchmark("Treap Benchmarks", treap_benchmarks);
+  benchmark_manager.add_benchmark("Tree Allocator Benchmarks",
+                                  tree_allocator_benchmarks);
+
+  benchmark_manager.print_results();
+  benchmark_manager.save_results();
+}
+
+auto main() -> int {
+  do_benchmark();
+
+  return 0;
+}
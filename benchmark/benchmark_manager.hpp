@@ -0,0 +1,61 @@
+#pragma once
+
+#include "core.h" // fmt/core.h
+#include "i_benchmark.hpp"
+#include "os.h" // fmt/os.h
+
+#include <string>
+#include <unordered_map>
+
+namespace pxd {
+class BenchmarkManager {
+public:
+  void add_benchmark(std::string &&name, IBenchmark &benchmark) {
+    benchmark.start_benchmark();
+    benchmarks[name] = benchmark.benchmark_results;
+  }
+
+  void print_results() noexcept {
+    for (auto &[benchmark_name, benchmark] : benchmarks) {
+      fmt::print(
+          "---------------------------------------------------------------\n");
+      fmt::print("Benchmark Name : {}\n", benchmark_name.c_str());
+
+      for (auto &[case_name, result] : benchmark) {
+        fmt::print("  {:40s} -> {:14.3f} {}\n", case_name.c_str(),
+                   result.value, result.unit.c_str());
+      }
+    }
+
+    fmt::print(
+        "---------------------------------------------------------------\n");
+  }
+
+  void save_results(const char *filename = "benchmark_results.txt") noexcept {
+    auto benchmark_file = fmt::output_file(filename);
+
+    for (auto &[benchmark_name, benchmark] : benchmarks) {
+      benchmark_file.print(
+          "-----------------------------------------------------------"
+          "----\n");
+
+      benchmark_file.print("Benchmark Name : {}\n", benchmark_name);
+
+      for (auto &[case_name, result] : benchmark) {
+        benchmark_file.print("   {:40s} -> {:14.3f} {}\n", case_name,
+                             result.value, result.unit);
+      }
+    }
+
+    benchmark_file.print(
+        "-----------------------------------------------------------"
+        "----\n");
+
+    benchmark_file.close();
+  }
+
+private:
+  std::unordered_map<std::string, std::map<std::string, BenchmarkResult>>
+      benchmarks;
+};
+} // namespace pxd
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "i_benchmark.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace pxd {
+class BenchmarkTimer {
+public:
+  BenchmarkTimer() { reset(); }
+
+  void reset() noexcept { start = std::chrono::steady_clock::now(); }
+
+  auto elapsed_ns() const noexcept -> double {
+    auto diff = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(diff).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point start;
+};
+
+/// @brief keep the compiler from optimizing away the given value
+/// @param value the value which is produced by the benchmarked code
+template <typename T> inline void do_not_optimize(const T &value) {
+#if defined(_MSC_VER)
+  const volatile void *sink = &value;
+  (void)sink;
+  _ReadWriteBarrier();
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/// @brief run the function for the given iteration count
+/// @param func benchmarked function, takes the current iteration index
+/// @param iterations total iteration count
+/// @return average nanoseconds per iteration
+template <typename Func>
+inline auto measure_ns_per_op(Func &&func, std::int64_t iterations) -> double {
+  BenchmarkTimer timer;
+
+  for (std::int64_t i = 0; i < iterations; i++) {
+    func(i);
+  }
+
+  return timer.elapsed_ns() / static_cast<double>(iterations);
+}
+
+/// @brief convert the operation count and the elapsed time to the throughput
+/// @param operations total operation count
+/// @param elapsed_ns elapsed time in nanoseconds
+/// @return million operations per second
+constexpr inline auto to_mops(double operations, double elapsed_ns) -> double {
+  return elapsed_ns > 0.0 ? operations / elapsed_ns * 1000.0 : 0.0;
+}
+
+/// @brief simple xorshift generator, cheap enough to not affect the benchmarks
+class BenchmarkRandom {
+public:
+  explicit BenchmarkRandom(std::uint64_t seed = 0x9E3779B97F4A7C15ULL)
+      : state(seed == 0 ? 1 : seed) {}
+
+  auto next() noexcept -> std::uint64_t {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+
+  auto next(std::uint64_t bound) noexcept -> std::uint64_t {
+    return next() % bound;
+  }
+
+private:
+  std::uint64_t state;
+};
+} // namespace pxd
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "bloom_filter.hpp"
+#include "format.h" // fmt/format.h
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class BloomFilterBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    // 1.2 MB filter fits the L2/L3 caches, 12 MB one does not
+    for (int size : {1'000'000, 10'000'000}) {
+      start_filter_benchmark(size, 0.01);
+    }
+  }
+
+private:
+  void start_filter_benchmark(int size, double false_positive_rate) {
+    const std::string name =
+        fmt::format("{:8d} keys {} fp", size, false_positive_rate);
+
+    // the first half is added, the lookups are the half hits
+    std::vector<std::uint64_t> keys(static_cast<std::size_t>(size) * 2);
+    BenchmarkRandom rng;
+
+    for (std::uint64_t &key : keys) {
+      key = rng.next();
+    }
+
+    BloomFilter filter =
+        BloomFilter::for_false_positive_rate(size, false_positive_rate);
+    BloomFilter batch_filter =
+        BloomFilter::for_false_positive_rate(size, false_positive_rate);
+
+    benchmark_results[name + " add"] = {
+        to_mops(size, measure_ns_per_op(
+                          [&](std::int64_t i) { filter.add(keys[i]); }, size) *
+                          size),
+        "Mops/s"};
+
+    BenchmarkTimer timer;
+    batch_filter.add_batch(keys.data(), size);
+
+    benchmark_results[name + " add batch"] = {
+        to_mops(size, timer.elapsed_ns()), "Mops/s"};
+
+    const int lookup_count = size * 2;
+    int found_count = 0;
+
+    benchmark_results[name + " contains"] = {
+        to_mops(lookup_count,
+                measure_ns_per_op(
+                    [&](std::int64_t i) {
+                      found_count += filter.contains(keys[i]);
+                    },
+                    lookup_count) *
+                    lookup_count),
+        "Mops/s"};
+
+    std::unique_ptr<bool[]> results(new bool[lookup_count]);
+    timer.reset();
+    batch_filter.contains_batch(keys.data(), lookup_count, results.get());
+
+    benchmark_results[name + " contains batch"] = {
+        to_mops(lookup_count, timer.elapsed_ns()), "Mops/s"};
+
+    benchmark_results[name + " measured fp rate"] = {
+        100.0 * (found_count - size) / size, "%"};
+    do_not_optimize(results[lookup_count - 1]);
+  }
+};
+} // namespace pxd
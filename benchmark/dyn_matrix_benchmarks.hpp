@@ -0,0 +1,100 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "dyn_matrix.hpp"
+#include "format.h" // fmt/format.h
+#include "thread_pool.hpp"
+
+#include <string>
+#include <vector>
+
+namespace pxd {
+class DynMatrixBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    ThreadPool single_thread_pool(1);
+    ThreadPool &shared_pool = ThreadPool::get_default();
+
+    for (int size : sizes) {
+      const std::string name = fmt::format("{:4d}x{:<4d}", size, size);
+
+      DynMatrix<float> left(size, size);
+      DynMatrix<float> right(size, size);
+      fill(left, 1);
+      fill(right, 2);
+
+      if (size <= naive_max_size) {
+        benchmark_results[name + " naive"] = {
+            measure_gflops(size, [&]() {
+              do_not_optimize(naive_multiply(left, right).get_ptr()[0]);
+            }),
+            "GFLOP/s"};
+      }
+
+      benchmark_results[name + " blocked 1 thread"] = {
+          measure_gflops(
+              size,
+              [&]() {
+                do_not_optimize(
+                    left.multiply(right, single_thread_pool).get_ptr()[0]);
+              }),
+          "GFLOP/s"};
+
+      benchmark_results[fmt::format("{} blocked {} threads", name,
+                                    shared_pool.get_thread_count())] = {
+          measure_gflops(size,
+                         [&]() {
+                           do_not_optimize(
+                               left.multiply(right, shared_pool).get_ptr()[0]);
+                         }),
+          "GFLOP/s"};
+    }
+  }
+
+private:
+  static void fill(DynMatrix<float> &matrix, std::uint64_t seed) {
+    BenchmarkRandom rng(seed);
+
+    for (int i = 0; i < matrix.get_row(); i++) {
+      for (int j = 0; j < matrix.get_column(); j++) {
+        matrix(i, j) = static_cast<float>(rng.next(100)) * 0.01f;
+      }
+    }
+  }
+
+  /// @brief i-k-j triple loop without the blocking and the threads
+  static auto naive_multiply(const DynMatrix<float> &left,
+                             const DynMatrix<float> &right)
+      -> DynMatrix<float> {
+    DynMatrix<float> result(left.get_row(), right.get_column());
+
+    for (int i = 0; i < left.get_row(); i++) {
+      for (int k = 0; k < left.get_column(); k++) {
+        const float value = left(i, k);
+
+        for (int j = 0; j < right.get_column(); j++) {
+          result(i, j) += value * right(k, j);
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /// @brief 2 * n^3 floating point operations for a n x n multiply
+  template <typename Func>
+  static auto measure_gflops(int size, Func &&func) -> double {
+    BenchmarkTimer timer;
+    func();
+    const double elapsed_ns = timer.elapsed_ns();
+
+    const double flops = 2.0 * size * static_cast<double>(size) * size;
+
+    return flops / elapsed_ns;
+  }
+
+private:
+  std::vector<int> sizes = {1024, 2048, 4096, 8192};
+  int naive_max_size = 1024;
+};
+} // namespace pxd
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "array.hpp"
+#include "benchmark_utils.hpp"
+#include "dynamic_array.hpp"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace pxd {
+class DynamicArrayBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    // the fixed growth is quadratic, it is measured with fewer values to finish
+    start_append_benchmark<int>("10M ints", int_count,
+                                eGROWTH_POLICY::GEOMETRIC, false);
+    start_append_benchmark<int>("10M ints", int_count,
+                                eGROWTH_POLICY::GEOMETRIC, true);
+    start_append_benchmark<int>("100K ints", fixed_int_count,
+                                eGROWTH_POLICY::FIXED, false);
+    start_vector_benchmark<int>("10M ints", int_count);
+
+    start_append_benchmark<std::string>("1M strings", string_count,
+                                        eGROWTH_POLICY::GEOMETRIC, false);
+    start_append_benchmark<std::string>("1M strings", string_count,
+                                        eGROWTH_POLICY::GEOMETRIC, true);
+    start_append_benchmark<std::string>("20K strings", fixed_string_count,
+                                        eGROWTH_POLICY::FIXED, false);
+    start_vector_benchmark<std::string>("1M strings", string_count);
+
+    start_push_pop_benchmark();
+  }
+
+private:
+  template <typename T> static auto make_value(int index) -> T {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // longer than the small string buffer, every value owns a heap block
+      return std::string(32, static_cast<char>('a' + index % 26));
+    } else {
+      return static_cast<T>(index);
+    }
+  }
+
+  template <typename T>
+  void start_append_benchmark(const std::string &name, int count,
+                              eGROWTH_POLICY policy, bool need_reserve) {
+    BenchmarkTimer timer;
+
+    {
+      DynamicArray<T> darray;
+      darray.set_growth_policy(policy);
+
+      if (need_reserve) {
+        darray.reserve(count);
+      }
+
+      for (int i = 0; i < count; i++) {
+        darray.add(make_value<T>(i));
+      }
+
+      do_not_optimize(darray.get_data());
+    }
+
+    const std::string policy_name =
+        need_reserve ? "reserved"
+                     : (policy == eGROWTH_POLICY::GEOMETRIC ? "geometric"
+                                                            : "fixed");
+
+    benchmark_results[name + " " + policy_name + " append"] = {
+        timer.elapsed_ns() / count, "ns/op"};
+  }
+
+  template <typename T>
+  void start_vector_benchmark(const std::string &name, int count) {
+    BenchmarkTimer timer;
+
+    {
+      std::vector<T> values;
+
+      for (int i = 0; i < count; i++) {
+        values.push_back(make_value<T>(i));
+      }
+
+      do_not_optimize(values.data());
+    }
+
+    benchmark_results[name + " std::vector append"] = {
+        timer.elapsed_ns() / count, "ns/op"};
+  }
+
+  /// @brief stack like usage around a capacity boundary, the hysteresis keeps
+  /// it from reallocating on every call
+  void start_push_pop_benchmark() {
+    DynamicArray<int> darray;
+
+    for (int i = 0; i < 1024; i++) {
+      darray.add(i);
+    }
+
+    // the next add has to grow the capacity
+    darray.shrink();
+
+    const double elapsed_ns = measure_ns_per_op(
+        [&darray](std::int64_t i) {
+          darray.add(static_cast<int>(i));
+          do_not_optimize(darray.remove_last());
+          do_not_optimize(darray.remove_last());
+          darray.add(static_cast<int>(i));
+        },
+        push_pop_rounds);
+
+    benchmark_results["add remove_last at boundary"] = {elapsed_ns / 4,
+                                                        "ns/op"};
+  }
+
+private:
+  int int_count = 10'000'000;
+  int fixed_int_count = 100'000;
+  int string_count = 1'000'000;
+  int fixed_string_count = 20'000;
+  int push_pop_rounds = 1'000'000;
+};
+} // namespace pxd
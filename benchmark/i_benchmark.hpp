@@ -0,0 +1,21 @@
+#pragma once
+
+#include "checks.hpp"
+#include <map>
+#include <string>
+
+namespace pxd {
+struct BenchmarkResult {
+  double value = 0.0;
+  std::string unit = "ns/op";
+};
+
+class IBenchmark {
+public:
+  virtual void start_benchmark() {
+    PXD_ASSERT_MSG(false, "Not implemented");
+  };
+
+  std::map<std::string, BenchmarkResult> benchmark_results;
+};
+} // namespace pxd
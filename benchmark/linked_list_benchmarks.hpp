@@ -0,0 +1,96 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "double_linked_list.hpp"
+#include "linked_list.hpp"
+#include "xor_double_linked_list.hpp"
+
+#include <string>
+
+namespace pxd {
+class LinkedListBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    start_churn_benchmark<LinkedList<int>>("linked list");
+    start_churn_benchmark<LinkedList<int, PoolNodeAllocator>>(
+        "pooled linked list");
+    start_churn_benchmark<DoubleLinkedList<int>>("double linked list");
+    start_churn_benchmark<DoubleLinkedList<int, PoolNodeAllocator>>(
+        "pooled double linked list");
+    start_churn_benchmark<XORDoubleLinkedList<int>>("xor double linked list");
+    start_churn_benchmark<XORDoubleLinkedList<int, PoolNodeAllocator>>(
+        "pooled xor double linked list");
+
+    start_traverse_benchmark<DoubleLinkedList<int>>("double linked list");
+    start_traverse_benchmark<DoubleLinkedList<int, PoolNodeAllocator>>(
+        "pooled double linked list");
+  }
+
+private:
+  template <typename List> void pop_front(List &list) {
+    list.remove(list.get_head_node()->value);
+  }
+
+  /// @brief queue like usage, every round pushes a batch to the back and pops
+  /// it from the front
+  template <typename List> void start_churn_benchmark(const std::string &name) {
+    List list;
+    list.reserve(batch_size);
+
+    BenchmarkTimer timer;
+
+    for (int round = 0; round < rounds; round++) {
+      for (int i = 0; i < batch_size; i++) {
+        list.add(i);
+      }
+
+      for (int i = 0; i < batch_size; i++) {
+        pop_front(list);
+      }
+    }
+
+    const double operations = 2.0 * rounds * batch_size;
+
+    benchmark_results[name + " push pop"] = {
+        to_mops(operations, timer.elapsed_ns()), "Mops/s"};
+  }
+
+  /// @brief nodes of the list are allocated between the other allocations and
+  /// then traversed, shows the cache locality of the nodes
+  template <typename List>
+  void start_traverse_benchmark(const std::string &name) {
+    List list;
+    List noise;
+
+    for (int i = 0; i < traverse_size; i++) {
+      list.add(i);
+      noise.add(i);
+    }
+
+    noise.release();
+
+    const double elapsed_ns = measure_ns_per_op(
+        [&](std::int64_t) {
+          long long sum = 0;
+          auto *current_node = list.get_head_node();
+
+          while (current_node != nullptr) {
+            sum += current_node->value;
+            current_node = current_node->next;
+          }
+
+          do_not_optimize(sum);
+        },
+        traverse_rounds);
+
+    benchmark_results[name + " traverse"] = {elapsed_ns / traverse_size,
+                                             "ns/node"};
+  }
+
+private:
+  int rounds = 1'000;
+  int batch_size = 10'000;
+  int traverse_size = 1'000'000;
+  int traverse_rounds = 10;
+};
+} // namespace pxd
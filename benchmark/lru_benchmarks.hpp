@@ -0,0 +1,135 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "lru.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace pxd {
+
+/// @brief the list scanning LRUCache implementation before the node handles,
+/// kept to compare the hit latency
+template <typename Key, typename Val> class LegacyLRUCache {
+private:
+  struct LRUNode {
+    Key key;
+    Val value;
+
+    auto operator==(const LRUNode &other) { return key == other.key; }
+    auto operator!=(const LRUNode &other) { return key != other.key; }
+  };
+
+public:
+  LegacyLRUCache(size_t max_size) : max_size(max_size) {}
+
+  void insert(Key key, Val value) {
+    if (lru_map.contains(key)) {
+      lru_map.erase(key);
+    }
+
+    LRUNode node;
+    node.key = key;
+    node.value = value;
+
+    lru_list.add(node);
+    lru_map.insert(
+        {key, std::make_unique<LRUNode>(lru_list.get_end_node()->value)});
+
+    if (lru_map.size() <= max_size) {
+      return;
+    }
+
+    auto head_node_value = lru_list.get_head_node()->value;
+
+    lru_list.remove(head_node_value);
+    lru_map.erase(head_node_value.key);
+  }
+
+  auto get(Key key) -> Val {
+    if (!lru_map.contains(key)) {
+      return {};
+    }
+
+    LRUNode node = *(lru_map[key]);
+    lru_list.remove(node);
+    lru_list.add(node);
+
+    return node.value;
+  }
+
+private:
+  size_t max_size;
+  DoubleLinkedList<LRUNode> lru_list;
+  absl::flat_hash_map<Key, std::unique_ptr<LRUNode>> lru_map;
+};
+
+class LRUCacheBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    start_hit_benchmark(1'000, "1k");
+    start_hit_benchmark(100'000, "100k");
+    start_hit_benchmark(1'000'000, "1M");
+  }
+
+private:
+  template <typename Cache>
+  auto measure_hits(Cache &cache, int size, std::int64_t iterations)
+      -> double {
+    BenchmarkRandom rng;
+
+    return measure_ns_per_op(
+        [&](std::int64_t) {
+          int key = static_cast<int>(rng.next(size));
+          do_not_optimize(cache.get(key));
+        },
+        iterations);
+  }
+
+  template <typename Cache>
+  auto measure_evictions(Cache &cache, int size, std::int64_t iterations)
+      -> double {
+    return measure_ns_per_op(
+        [&](std::int64_t i) {
+          int key = size + static_cast<int>(i);
+          cache.insert(key, key);
+        },
+        iterations);
+  }
+
+  void start_hit_benchmark(int size, const std::string &size_name) {
+    // the legacy hit is O(capacity), scale its iterations down
+    const std::int64_t legacy_iterations =
+        std::max<std::int64_t>(100, 100'000'000 / size);
+
+    {
+      LRUCache<int, int> cache(size);
+
+      for (int i = 0; i < size; i++) {
+        cache.insert(i, i);
+      }
+
+      benchmark_results["hit " + size_name] = {
+          measure_hits(cache, size, iterations), "ns/op"};
+      benchmark_results["insert evict " + size_name] = {
+          measure_evictions(cache, size, iterations), "ns/op"};
+    }
+
+    {
+      LegacyLRUCache<int, int> cache(size);
+
+      for (int i = 0; i < size; i++) {
+        cache.insert(i, i);
+      }
+
+      benchmark_results["legacy hit " + size_name] = {
+          measure_hits(cache, size, legacy_iterations), "ns/op"};
+      benchmark_results["legacy insert evict " + size_name] = {
+          measure_evictions(cache, size, iterations), "ns/op"};
+    }
+  }
+
+private:
+  std::int64_t iterations = 1'000'000;
+};
+} // namespace pxd
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "ds/array.hpp"
+#include "format.h" // fmt/format.h
+#include "matrix.hpp"
+
+#include <string>
+
+namespace pxd {
+class MatrixBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    start_size_benchmark<4>();
+    start_size_benchmark<8>();
+    start_size_benchmark<16>();
+    start_size_benchmark<32>();
+    start_size_benchmark<64>();
+  }
+
+private:
+  /// @brief the transpose before the blocked transpose, a divide and a modulo
+  /// for every value and only correct for the square matrices
+  template <size_t Size> static void legacy_transpose(float *matrix) {
+    constexpr int row = Size;
+    constexpr int column = Size;
+    constexpr int element_count = Size * Size;
+
+    for (int i = 0; i < element_count; i++) {
+      const int current_row = i / row;
+      const int current_col = i % column;
+
+      const int normal_index = current_row * column + current_col;
+      const int transpose_index = current_col * column + current_row;
+
+      if (current_col == current_row) {
+        i += (column - current_col - 1);
+        continue;
+      }
+
+      const float temp = matrix[normal_index];
+      matrix[normal_index] = matrix[transpose_index];
+      matrix[transpose_index] = temp;
+    }
+  }
+
+  /// @brief textbook i-j-k multiply
+  template <size_t Size>
+  static void naive_multiply(const float *a, const float *b, float *c) {
+    for (size_t i = 0; i < Size; i++) {
+      for (size_t j = 0; j < Size; j++) {
+        float sum = 0.0f;
+
+        for (size_t k = 0; k < Size; k++) {
+          sum += a[i * Size + k] * b[k * Size + j];
+        }
+
+        c[i * Size + j] = sum;
+      }
+    }
+  }
+
+  template <size_t Size> void start_size_benchmark() {
+    Matrix<float, Size, Size> left;
+    Matrix<float, Size, Size> right;
+    Matrix<float, Size, Size> result;
+
+    for (size_t i = 0; i < Size * Size; i++) {
+      left.get_data()[i] = static_cast<float>(i % 13) * 0.5f;
+      right.get_data()[i] = static_cast<float>(i % 7) * 0.25f;
+    }
+
+    const std::string name = fmt::format("{:2d}x{:<2d}", Size, Size);
+    // about the same amount of work for every size
+    const std::int64_t iterations = element_work_count / (Size * Size);
+    const std::int64_t multiply_iterations =
+        iterations / static_cast<std::int64_t>(Size) + 1;
+
+    benchmark_results[name + " transpose legacy"] = {
+        measure_ns_per_op(
+            [&left](std::int64_t) {
+              legacy_transpose<Size>(left.get_data());
+              do_not_optimize(left.get_data()[1]);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " transpose blocked"] = {
+        measure_ns_per_op(
+            [&left](std::int64_t) {
+              left.transpose();
+              do_not_optimize(left.get_data()[1]);
+            },
+            iterations),
+        "ns/op"};
+
+    // the row indexing used to copy every row to a new Array
+    benchmark_results[name + " row access copy"] = {
+        measure_ns_per_op(
+            [&left](std::int64_t) {
+              float sum = 0.0f;
+
+              for (size_t i = 0; i < Size; i++) {
+                Array<float> row(left.get_data() + i * Size, Size);
+                sum += row[static_cast<int>(i)];
+              }
+
+              do_not_optimize(sum);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " row access view"] = {
+        measure_ns_per_op(
+            [&left](std::int64_t) {
+              float sum = 0.0f;
+
+              for (size_t i = 0; i < Size; i++) {
+                sum += left[static_cast<int>(i)][static_cast<int>(i)];
+              }
+
+              do_not_optimize(sum);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " add scalar"] = {
+        measure_ns_per_op(
+            [&left, &right](std::int64_t) {
+              matrix_detail::add_scalar(left.get_ptr(), right.get_ptr(),
+                                        left.get_data(), 0, Size * Size);
+              do_not_optimize(left.get_data()[0]);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " add simd"] = {
+        measure_ns_per_op(
+            [&left, &right](std::int64_t) {
+              left += right;
+              do_not_optimize(left.get_data()[0]);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " scale simd"] = {
+        measure_ns_per_op(
+            [&left](std::int64_t) {
+              left *= 0.5f;
+              do_not_optimize(left.get_data()[0]);
+            },
+            iterations),
+        "ns/op"};
+
+    benchmark_results[name + " multiply naive"] = {
+        measure_ns_per_op(
+            [&left, &right, &result](std::int64_t) {
+              naive_multiply<Size>(left.get_ptr(), right.get_ptr(),
+                                   result.get_data());
+              do_not_optimize(result.get_data()[0]);
+            },
+            multiply_iterations),
+        "ns/op"};
+
+    benchmark_results[name + " multiply tiled"] = {
+        measure_ns_per_op(
+            [&left, &right, &result](std::int64_t) {
+              result = left * right;
+              do_not_optimize(result.get_data()[0]);
+            },
+            multiply_iterations),
+        "ns/op"};
+  }
+
+private:
+  std::int64_t element_work_count = 100'000'000;
+};
+} // namespace pxd
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "multi_queue.hpp"
+#include "priority_queue.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+
+/// @brief single lock PriorityQueue, the way it had to be shared between
+/// threads before the MultiQueue
+template <typename T> class MutexPriorityQueue {
+public:
+  void push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.insert(value, value);
+  }
+
+  auto try_pop(T &value) -> bool {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (queue.get_size() == 0) {
+      return false;
+    }
+
+    value = queue.top();
+    return true;
+  }
+
+private:
+  std::mutex mutex;
+  PriorityQueue<T> queue;
+};
+
+class MultiQueueBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int thread_count : {1, 2, 4, 8, 16, 32, 64}) {
+      const std::string name = fmt::format("{:2d} threads", thread_count);
+
+      {
+        MultiQueue<int> queue;
+        fill(queue);
+
+        benchmark_results["multi queue try pop " + name] = {
+            run_threads(queue, thread_count), "Mops/s"};
+      }
+
+      {
+        MutexPriorityQueue<int> queue;
+        fill(queue);
+
+        benchmark_results["single mutex " + name] = {
+            run_threads(queue, thread_count), "Mops/s"};
+      }
+    }
+  }
+
+private:
+  template <typename Queue> void fill(Queue &queue) {
+    BenchmarkRandom rng;
+
+    for (int i = 0; i < prefill_count; i++) {
+      queue.push(static_cast<int>(rng.next(1 << 20)));
+    }
+  }
+
+  /// @brief every thread pushes a value and pops one, the scheduler loop of
+  /// a ready queue, so the size stays at the prefill count
+  /// @return total throughput of the all threads
+  template <typename Queue>
+  auto run_threads(Queue &queue, int thread_count) -> double {
+    std::atomic<bool> is_started = false;
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+
+    for (int t = 0; t < thread_count; t++) {
+      threads.emplace_back([&queue, &is_started, t, this] {
+        BenchmarkRandom rng(t + 1);
+        int value = 0;
+
+        while (!is_started.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+
+        for (int i = 0; i < ops_per_thread; i++) {
+          queue.push(static_cast<int>(rng.next(1 << 20)));
+          do_not_optimize(queue.try_pop(value));
+        }
+      });
+    }
+
+    BenchmarkTimer timer;
+    is_started.store(true, std::memory_order_release);
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    const double elapsed_ns = timer.elapsed_ns();
+
+    // a push and a pop per iteration
+    return to_mops(static_cast<double>(ops_per_thread) * 2 * thread_count,
+                   elapsed_ns);
+  }
+
+private:
+  int prefill_count = 1 << 16;
+  int ops_per_thread = 100'000;
+};
+} // namespace pxd
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "indexed_dheap.hpp"
+#include "priority_queue.hpp"
+
+#include <string>
+#include <vector>
+
+namespace pxd {
+class PriorityQueueBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {1'000, 10'000, 100'000}) {
+      start_update_benchmark(size);
+    }
+
+    for (int size : {1'000'000, 10'000'000}) {
+      start_build_benchmark(size);
+    }
+  }
+
+private:
+  /// @brief random priority changes of the keys which are in the queue, the
+  /// decrease-key step of a Dijkstra-style scheduler
+  void start_update_benchmark(int size) {
+    const std::string name = fmt::format("{:6d} keys", size);
+
+    {
+      PriorityQueue<int, 4, false> queue;
+
+      for (int i = 0; i < size; i++) {
+        queue.insert(i, size - i);
+      }
+
+      BenchmarkRandom rng;
+
+      benchmark_results[name + " update priority linear"] = {
+          measure_ns_per_op(
+              [&](std::int64_t) {
+                int key = static_cast<int>(rng.next(size));
+                queue.update_priority(key,
+                                      static_cast<int>(rng.next(size * 4)));
+              },
+              get_linear_update_count(size)),
+          "ns/op"};
+    }
+
+    {
+      IndexedDHeap<int, int, 4, false> heap(size);
+
+      for (int i = 0; i < size; i++) {
+        heap.insert(i, size - i);
+      }
+
+      BenchmarkRandom rng;
+
+      benchmark_results[name + " update priority indexed"] = {
+          measure_ns_per_op(
+              [&](std::int64_t) {
+                const int key = static_cast<int>(rng.next(size));
+                heap.update(key, static_cast<int>(rng.next(size * 4)));
+              },
+              update_count),
+          "ns/op"};
+
+      benchmark_results[name + " remove indexed"] = {
+          measure_ns_per_op(
+              [&](std::int64_t i) {
+                // remove and put back to keep the size
+                const int key = static_cast<int>(i % size);
+                heap.remove(key);
+                heap.insert(key, static_cast<int>(rng.next(size * 4)));
+              },
+              update_count),
+          "ns/op"};
+    }
+  }
+
+  /// @brief build a heap of random values and drain it
+  void start_build_benchmark(int size) {
+    const std::string name = fmt::format("{:8d} values", size);
+
+    std::vector<int> values(size);
+    BenchmarkRandom rng;
+
+    for (int &value : values) {
+      value = static_cast<int>(rng.next());
+    }
+
+    DHeap<int> inserted_heap;
+    DHeap<int> built_heap;
+
+    benchmark_results[name + " build with inserts"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              for (int value : values) {
+                inserted_heap.insert(value);
+              }
+            },
+            1) /
+            1'000'000.0,
+        "ms"};
+
+    benchmark_results[name + " build from range"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              built_heap.from_range(values.begin(), values.end());
+            },
+            1) /
+            1'000'000.0,
+        "ms"};
+
+    benchmark_results[name + " drain with top"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              while (inserted_heap.get_size() > 0) {
+                do_not_optimize(inserted_heap.top());
+              }
+            },
+            1) /
+            1'000'000.0,
+        "ms"};
+
+    benchmark_results[name + " drain pop all sorted"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              do_not_optimize(built_heap.pop_all_sorted().back());
+            },
+            1) /
+            1'000'000.0,
+        "ms"};
+  }
+
+  /// @brief the linear updates are O(n), keep the total work about the same
+  auto get_linear_update_count(int size) const -> std::int64_t {
+    const std::int64_t count = linear_work_count / size;
+    return count > 0 ? count : 1;
+  }
+
+private:
+  std::int64_t update_count = 1'000'000;
+  std::int64_t linear_work_count = 200'000'000;
+};
+} // namespace pxd
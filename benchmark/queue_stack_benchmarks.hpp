@@ -0,0 +1,81 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+
+#include <string>
+
+namespace pxd {
+class QueueStackBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    start_queue_benchmark<Queue<int>>("linked list queue");
+    start_queue_benchmark<Queue<int, LinkedList<int, PoolNodeAllocator>>>(
+        "pooled linked list queue");
+    start_queue_benchmark<RingQueue<int>>("ring buffer queue");
+
+    start_stack_benchmark<Stack<int>>("linked list stack");
+    start_stack_benchmark<Stack<int, LinkedList<int, PoolNodeAllocator>>>(
+        "pooled linked list stack");
+    start_stack_benchmark<RingStack<int>>("ring buffer stack");
+  }
+
+private:
+  /// @brief producer consumer usage, every round pushes a batch and pops it
+  template <typename QueueType>
+  void start_queue_benchmark(const std::string &name) {
+    QueueType queue;
+    long long sum = 0;
+
+    BenchmarkTimer timer;
+
+    for (int round = 0; round < rounds; round++) {
+      for (int i = 0; i < batch_size; i++) {
+        queue.push(i);
+      }
+
+      for (int i = 0; i < batch_size; i++) {
+        sum += queue.pop();
+      }
+    }
+
+    const double elapsed_ns = timer.elapsed_ns();
+    do_not_optimize(sum);
+
+    benchmark_results[name + " push pop"] = {
+        to_mops(2.0 * rounds * batch_size, elapsed_ns), "Mops/s"};
+  }
+
+  /// @brief depth first search like usage, pushes and pops are interleaved
+  template <typename StackType>
+  void start_stack_benchmark(const std::string &name) {
+    StackType stack;
+    long long sum = 0;
+
+    BenchmarkTimer timer;
+
+    for (int round = 0; round < rounds; round++) {
+      for (int i = 0; i < batch_size; i++) {
+        stack.push(i);
+        stack.push(i);
+        sum += stack.pop();
+      }
+
+      while (!stack.is_empty()) {
+        sum += stack.pop();
+      }
+    }
+
+    const double elapsed_ns = timer.elapsed_ns();
+    do_not_optimize(sum);
+
+    benchmark_results[name + " push pop"] = {
+        to_mops(4.0 * rounds * batch_size, elapsed_ns), "Mops/s"};
+  }
+
+private:
+  int rounds = 1'000;
+  int batch_size = 10'000;
+};
+} // namespace pxd
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "dynamic_ring_buffer.hpp"
+#include "format.h" // fmt/format.h
+#include "ring_buffer.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+
+/// @brief bounded ring buffer behind a single lock, the baseline of the lock
+/// free ring buffers
+template <typename T, size_t N> class MutexRingBuffer {
+public:
+  MutexRingBuffer() { buffer.reserve(N); }
+
+  auto try_push(const T &value) -> bool {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (buffer.get_length() == static_cast<int>(N)) {
+      return false;
+    }
+
+    buffer.push_back(value);
+    return true;
+  }
+
+  auto try_pop(T &value) -> bool {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (buffer.is_empty()) {
+      return false;
+    }
+
+    value = buffer.pop_front();
+    return true;
+  }
+
+private:
+  std::mutex mutex;
+  DynamicRingBuffer<T> buffer;
+};
+
+class RingBufferBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    {
+      SPSCRingBuffer<int, capacity> buffer;
+      benchmark_results["spsc 1p 1c"] = {run_threads(buffer, 1, 1), "Mops/s"};
+    }
+
+    {
+      SPSCRingBuffer<int, capacity> buffer;
+      benchmark_results["spsc bulk 1p 1c"] = {run_bulk_threads(buffer),
+                                              "Mops/s"};
+    }
+
+    for (int thread_count : {1, 2, 4}) {
+      const std::string name =
+          fmt::format("{}p {}c", thread_count, thread_count);
+
+      {
+        MPMCRingBuffer<int, capacity> buffer;
+        benchmark_results["mpmc " + name] = {
+            run_threads(buffer, thread_count, thread_count), "Mops/s"};
+      }
+
+      {
+        MutexRingBuffer<int, capacity> buffer;
+        benchmark_results["mutex " + name] = {
+            run_threads(buffer, thread_count, thread_count), "Mops/s"};
+      }
+    }
+
+    benchmark_results["spsc round trip"] = {
+        run_ping_pong<SPSCRingBuffer<int, capacity>>(), "ns/op"};
+    benchmark_results["mpmc round trip"] = {
+        run_ping_pong<MPMCRingBuffer<int, capacity>>(), "ns/op"};
+    benchmark_results["mutex round trip"] = {
+        run_ping_pong<MutexRingBuffer<int, capacity>>(), "ns/op"};
+  }
+
+private:
+  template <typename Buffer> static void push(Buffer &buffer, int value) {
+    while (!buffer.try_push(value)) {
+      std::this_thread::yield();
+    }
+  }
+
+  template <typename Buffer> static auto pop(Buffer &buffer) -> int {
+    int value = 0;
+
+    while (!buffer.try_pop(value)) {
+      std::this_thread::yield();
+    }
+
+    return value;
+  }
+
+  /// @brief the producers hand value_count values in total to the consumers
+  /// @return handed values per second
+  template <typename Buffer>
+  auto run_threads(Buffer &buffer, int producer_count, int consumer_count)
+      -> double {
+    std::vector<std::thread> threads;
+    BenchmarkTimer timer;
+
+    for (int t = 0; t < producer_count; t++) {
+      threads.emplace_back([&buffer, t, producer_count, this] {
+        for (int i = t; i < value_count; i += producer_count) {
+          push(buffer, i);
+        }
+      });
+    }
+
+    for (int t = 0; t < consumer_count; t++) {
+      threads.emplace_back([&buffer, t, consumer_count, this] {
+        long long sum = 0;
+
+        for (int i = t; i < value_count; i += consumer_count) {
+          sum += pop(buffer);
+        }
+
+        do_not_optimize(sum);
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    return to_mops(value_count, timer.elapsed_ns());
+  }
+
+  /// @brief the values are handed in batches, the way the io thread hands the
+  /// read chunks to the parser thread
+  template <typename Buffer> auto run_bulk_threads(Buffer &buffer) -> double {
+    BenchmarkTimer timer;
+
+    std::thread producer([&buffer, this] {
+      int values[batch_size];
+
+      for (int i = 0; i < value_count;) {
+        for (int j = 0; j < batch_size; j++) {
+          values[j] = i + j;
+        }
+
+        int pushed_count = 0;
+
+        while (pushed_count < batch_size) {
+          pushed_count += static_cast<int>(buffer.push_n(
+              values + pushed_count, batch_size - pushed_count));
+
+          if (pushed_count < batch_size) {
+            std::this_thread::yield();
+          }
+        }
+
+        i += batch_size;
+      }
+    });
+
+    std::thread consumer([&buffer, this] {
+      int values[batch_size];
+      long long sum = 0;
+
+      for (int popped_count = 0; popped_count < value_count;) {
+        const int count = static_cast<int>(buffer.pop_n(values, batch_size));
+
+        if (count == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+
+        for (int j = 0; j < count; j++) {
+          sum += values[j];
+        }
+
+        popped_count += count;
+      }
+
+      do_not_optimize(sum);
+    });
+
+    producer.join();
+    consumer.join();
+
+    return to_mops(value_count, timer.elapsed_ns());
+  }
+
+  /// @brief a value goes to the other thread and comes back
+  /// @return average nanoseconds of a round trip
+  template <typename Buffer> auto run_ping_pong() -> double {
+    Buffer ping;
+    Buffer pong;
+
+    std::thread echo([&ping, &pong, this] {
+      for (int i = 0; i < round_trip_count; i++) {
+        push(pong, pop(ping));
+      }
+    });
+
+    const double elapsed_ns = measure_ns_per_op(
+        [&ping, &pong](std::int64_t i) {
+          push(ping, static_cast<int>(i));
+          do_not_optimize(pop(pong));
+        },
+        round_trip_count);
+
+    echo.join();
+
+    return elapsed_ns;
+  }
+
+private:
+  static constexpr size_t capacity = 1024;
+  static constexpr int batch_size = 64;
+
+  int value_count = 10'000'000;
+  int round_trip_count = 100'000;
+};
+} // namespace pxd
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "binary_search_tree.hpp"
+#include "btree.hpp"
+#include "eytzinger_tree.hpp"
+#include "format.h" // fmt/format.h
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class SearchTreeBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {1'000, 100'000, 1'000'000}) {
+      start_search_benchmark(size);
+    }
+
+    // the plain BST is a list for the sorted adds, O(n^2), the 1M adds would
+    // take hours so it stops at 50K
+    for (int size : {10'000, 50'000}) {
+      start_ascending_add_benchmark(size, eBST_BALANCE::NONE);
+    }
+
+    for (int size : {10'000, 50'000, 1'000'000}) {
+      start_ascending_add_benchmark(size, eBST_BALANCE::AVL);
+    }
+  }
+
+private:
+  void start_search_benchmark(int size) {
+    const std::string name = fmt::format("{:7d} keys", size);
+
+    // the even keys are in the trees, the lookups hit half of the time
+    std::vector<int> sorted_keys(size);
+    std::vector<int> random_keys(size);
+    std::vector<int> lookup_keys(lookup_count);
+    BenchmarkRandom rng;
+
+    for (int i = 0; i < size; i++) {
+      sorted_keys[i] = i * 2;
+      random_keys[i] = i * 2;
+    }
+
+    // the random insert order keeps the plain BST O(log n) deep
+    for (int i = size - 1; i > 0; i--) {
+      std::swap(random_keys[i], random_keys[rng.next(i + 1)]);
+    }
+
+    for (int &key : lookup_keys) {
+      key = static_cast<int>(rng.next(size * 2));
+    }
+
+    BinarySearchTree<int> bst;
+    BTree<int, 16> btree_16;
+    BTree<int, 64> btree_64;
+
+    benchmark_results[name + " insert bst"] = {
+        measure_ns_per_op([&](std::int64_t i) { bst.add(random_keys[i]); },
+                          size),
+        "ns/op"};
+    benchmark_results[name + " insert btree 16"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) { btree_16.insert(random_keys[i]); }, size),
+        "ns/op"};
+    benchmark_results[name + " insert btree 64"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) { btree_64.insert(random_keys[i]); }, size),
+        "ns/op"};
+
+    EytzingerTree<int> eytzinger_tree(sorted_keys.data(), size);
+
+    benchmark_results[name + " lookup bst"] = {
+        measure_lookup([&](int key) { return bst.is_contain(key); },
+                       lookup_keys),
+        "ns/op"};
+    benchmark_results[name + " lookup sorted array binary search"] = {
+        measure_lookup(
+            [&](int key) {
+              return std::binary_search(sorted_keys.begin(),
+                                        sorted_keys.end(), key);
+            },
+            lookup_keys),
+        "ns/op"};
+    benchmark_results[name + " lookup eytzinger"] = {
+        measure_lookup([&](int key) { return eytzinger_tree.contains(key); },
+                       lookup_keys),
+        "ns/op"};
+    benchmark_results[name + " lookup btree 16"] = {
+        measure_lookup([&](int key) { return btree_16.contains(key); },
+                       lookup_keys),
+        "ns/op"};
+    benchmark_results[name + " lookup btree 64"] = {
+        measure_lookup([&](int key) { return btree_64.contains(key); },
+                       lookup_keys),
+        "ns/op"};
+  }
+
+  void start_ascending_add_benchmark(int size, eBST_BALANCE balance) {
+    const std::string name =
+        fmt::format("{:7d} ascending adds bst {}", size,
+                    balance == eBST_BALANCE::AVL ? "avl" : "unbalanced");
+
+    BinarySearchTree<int> bst(balance);
+
+    benchmark_results[name] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              for (int i = 0; i < size; i++) {
+                bst.add(i);
+              }
+            },
+            1) /
+            1'000'000.0,
+        "ms"};
+  }
+
+  template <typename Func>
+  static auto measure_lookup(Func &&func, const std::vector<int> &keys)
+      -> double {
+    return measure_ns_per_op(
+        [&](std::int64_t i) { do_not_optimize(func(keys[i])); },
+        static_cast<std::int64_t>(keys.size()));
+  }
+
+private:
+  int lookup_count = 1'000'000;
+};
+} // namespace pxd
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "sharded_lru.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+
+/// @brief single lock LRUCache, the way it had to be shared between threads
+/// before the ShardedLRUCache
+template <typename Key, typename Val> class MutexLRUCache {
+public:
+  MutexLRUCache(size_t max_size) : cache(max_size) {}
+
+  void insert(const Key &key, Val value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    cache.insert(key, value);
+  }
+
+  auto try_get(const Key &key, Val &value) -> bool {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cache.try_get(key, value);
+  }
+
+private:
+  std::mutex mutex;
+  LRUCache<Key, Val> cache;
+};
+
+class ShardedLRUCacheBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int thread_count : {1, 2, 4, 8, 16, 32, 64}) {
+      const std::string name = fmt::format("{:2d} threads", thread_count);
+
+      {
+        ShardedLRUCache<int, int, 64> cache(capacity / 64);
+        fill(cache);
+
+        benchmark_results["sharded " + name] = {
+            run_threads(cache, thread_count), "Mops/s"};
+      }
+
+      {
+        MutexLRUCache<int, int> cache(capacity);
+        fill(cache);
+
+        benchmark_results["single mutex " + name] = {
+            run_threads(cache, thread_count), "Mops/s"};
+      }
+    }
+  }
+
+private:
+  template <typename Cache> void fill(Cache &cache) {
+    for (int i = 0; i < capacity; i++) {
+      cache.insert(i, i);
+    }
+  }
+
+  /// @brief every thread runs the same 90% get 10% insert mix over a key space
+  /// which is two times bigger than the capacity
+  /// @return total throughput of the all threads
+  template <typename Cache>
+  auto run_threads(Cache &cache, int thread_count) -> double {
+    std::atomic<bool> is_started = false;
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+
+    for (int t = 0; t < thread_count; t++) {
+      threads.emplace_back([&cache, &is_started, t, this] {
+        BenchmarkRandom rng(t + 1);
+        int value = 0;
+
+        while (!is_started.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+
+        for (int i = 0; i < ops_per_thread; i++) {
+          int key = static_cast<int>(rng.next(capacity * 2));
+
+          if (rng.next(10) == 0) {
+            cache.insert(key, key);
+          } else {
+            do_not_optimize(cache.try_get(key, value));
+          }
+        }
+      });
+    }
+
+    BenchmarkTimer timer;
+    is_started.store(true, std::memory_order_release);
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    const double elapsed_ns = timer.elapsed_ns();
+
+    return to_mops(static_cast<double>(ops_per_thread) * thread_count,
+                   elapsed_ns);
+  }
+
+private:
+  int capacity = 1 << 16;
+  int ops_per_thread = 200'000;
+};
+} // namespace pxd
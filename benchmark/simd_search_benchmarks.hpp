@@ -0,0 +1,81 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "simd.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class SIMDSearchBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {64, 1 << 10, 1 << 14, 1 << 18, 1 << 22, 1 << 26}) {
+      start_size_benchmark(size);
+    }
+  }
+
+private:
+  void start_size_benchmark(int size) {
+    std::vector<int> values(size);
+
+    for (int i = 0; i < size; i++) {
+      values[i] = i;
+    }
+
+    const int *data = values.data();
+    const std::string name = fmt::format("{:>9} ints", size);
+    // the value is not in the array, every search scans the whole array
+    const int missing_value = -1;
+
+    measure(name + " find scalar", size, [&] {
+      return simd_detail::find_scalar(data, 0, size, missing_value);
+    });
+    measure(name + " count scalar", size, [&] {
+      return simd_detail::count_scalar(data, 0, size, missing_value);
+    });
+
+    if (has_sse42()) {
+      measure(name + " find sse4.2", size, [&] {
+        return simd_detail::sse42_find(data, size, missing_value);
+      });
+      measure(name + " count sse4.2", size, [&] {
+        return simd_detail::sse42_count(data, size, missing_value);
+      });
+    }
+
+    if (has_avx2()) {
+      measure(name + " find avx2", size, [&] {
+        return simd_detail::avx2_find(data, size, missing_value);
+      });
+      measure(name + " count avx2", size, [&] {
+        return simd_detail::avx2_count(data, size, missing_value);
+      });
+    }
+
+    std::vector<std::uint64_t> bitmap(get_bitmap_word_count(size));
+
+    measure(name + " find all dispatched", size, [&] {
+      return simd_find_all(data, size, size / 2, bitmap.data());
+    });
+  }
+
+  /// @brief run the search until about the same byte count is scanned for
+  /// every size
+  template <typename Func>
+  void measure(const std::string &name, int size, Func &&func) {
+    const std::int64_t iterations =
+        std::max<std::int64_t>(1, scanned_byte_count / (size * sizeof(int)));
+
+    const double elapsed_ns = measure_ns_per_op(
+        [&func](std::int64_t) { do_not_optimize(func()); }, iterations);
+
+    benchmark_results[name] = {size * sizeof(int) / elapsed_ns, "GB/s"};
+  }
+
+private:
+  std::int64_t scanned_byte_count = std::int64_t(1) << 30;
+};
+} // namespace pxd
@@ -0,0 +1,421 @@
+#pragma once
+
+#include "absl/hash.hpp"
+#include "absl/str_cat.hpp"
+#include "absl/str_replace.hpp"
+#include "absl/str_split.hpp"
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "string.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pxd {
+class StringBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    // the short keys fit inline, the long ones allocate
+    start_key_benchmark(8, 32);
+    start_key_benchmark(48, 96);
+    start_replace_benchmark();
+    start_search_benchmark();
+    start_builder_benchmark();
+  }
+
+private:
+  void start_key_benchmark(int min_length, int max_length) {
+    const std::string name =
+        fmt::format("{:2d}-{:2d} byte keys", min_length, max_length);
+
+    // the keys are slices of a random text
+    std::vector<char> text(static_cast<std::size_t>(max_length) * 64);
+    std::vector<int> offsets(key_count);
+    std::vector<int> lengths(key_count);
+    BenchmarkRandom rng;
+
+    for (char &c : text) {
+      c = static_cast<char>('a' + rng.next(26));
+    }
+
+    for (int i = 0; i < key_count; i++) {
+      lengths[i] =
+          min_length + static_cast<int>(rng.next(max_length - min_length + 1));
+      offsets[i] = static_cast<int>(rng.next(text.size() - lengths[i]));
+    }
+
+    std::vector<std::string> std_keys;
+    std::vector<String> keys;
+    std::vector<String> arena_keys;
+    std_keys.reserve(key_count);
+    keys.reserve(key_count);
+    arena_keys.reserve(key_count);
+
+    StringArena arena;
+
+    benchmark_results[name + " build std::string"] = {
+        measure_build(std_keys,
+                      [&](std::int64_t i) {
+                        std_keys.emplace_back(text.data() + offsets[i],
+                                              lengths[i]);
+                      }),
+        "ns/op"};
+    benchmark_results[name + " build String"] = {
+        measure_build(keys,
+                      [&](std::int64_t i) {
+                        keys.emplace_back(text.data() + offsets[i],
+                                          lengths[i]);
+                      }),
+        "ns/op"};
+    benchmark_results[name + " build String arena"] = {
+        measure_build(
+            arena_keys,
+            [&](std::int64_t i) {
+              arena_keys.emplace_back(text.data() + offsets[i], lengths[i],
+                                      &arena);
+            },
+            &arena),
+        "ns/op"};
+
+    benchmark_results[name + " copy std::string"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              std::vector<std::string> copies(std_keys);
+              do_not_optimize(copies.data());
+            },
+            1) /
+            key_count,
+        "ns/op"};
+    benchmark_results[name + " copy String"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              std::vector<String> copies(keys);
+              do_not_optimize(copies.data());
+            },
+            1) /
+            key_count,
+        "ns/op"};
+
+    const std::string std_prefix = "cache:";
+    const String prefix = "cache:";
+
+    benchmark_results[name + " concat std::string"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              std::string key = std_prefix + std_keys[i];
+              do_not_optimize(key.data());
+            },
+            key_count),
+        "ns/op"};
+    benchmark_results[name + " concat String"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              String key = prefix + keys[i];
+              do_not_optimize(key.data());
+            },
+            key_count),
+        "ns/op"};
+
+    // a parsed token is hashed as a copy or as a view of the text
+    std::size_t hash_sum = 0;
+
+    benchmark_results[name + " token hash String"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              const String token(text.data() + offsets[i], lengths[i]);
+              hash_sum += absl::HashOf(token);
+            },
+            key_count),
+        "ns/op"};
+    benchmark_results[name + " token hash StringView"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              const StringView token(text.data() + offsets[i], lengths[i]);
+              hash_sum += absl::HashOf(token);
+            },
+            key_count),
+        "ns/op"};
+    do_not_optimize(hash_sum);
+
+    // the heap frees every key, the arena is rewound for the next keys
+    benchmark_results[name + " destroy String"] = {
+        measure_ns_per_op([&](std::int64_t) { keys.clear(); }, 1) /
+            key_count,
+        "ns/op"};
+    benchmark_results[name + " destroy String arena"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              arena_keys.clear();
+              arena.reset();
+            },
+            1) /
+            key_count,
+        "ns/op"};
+  }
+
+  void start_replace_benchmark() {
+    // 200 byte log lines of random words, scrubbed against 32 needles
+    const int line_count = 100'000;
+    const int needle_count = 32;
+    BenchmarkRandom rng;
+
+    auto random_word = [&](int length) {
+      std::string word(length, ' ');
+
+      for (char &c : word) {
+        c = static_cast<char>('a' + rng.next(26));
+      }
+
+      return word;
+    };
+
+    std::vector<std::string> needles;
+    std::vector<std::pair<std::string, std::string>> std_replacements;
+    StringReplacements replacements;
+
+    for (int i = 0; i < needle_count; i++) {
+      needles.push_back(random_word(6 + static_cast<int>(rng.next(7))));
+    }
+
+    for (const std::string &needle : needles) {
+      std_replacements.emplace_back(needle, "<redacted>");
+      replacements.emplace_back(needle, "<redacted>");
+    }
+
+    std::vector<std::string> lines(line_count);
+
+    for (std::string &line : lines) {
+      while (line.length() < 200) {
+        // one word in 8 is a needle
+        if (rng.next(8) == 0) {
+          line += needles[rng.next(needle_count)];
+        } else {
+          line += random_word(3 + static_cast<int>(rng.next(6)));
+        }
+
+        line += ' ';
+      }
+    }
+
+    std::size_t length_sum = 0;
+
+    benchmark_results["replace 32 needles find per needle"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              std::string line = lines[i];
+
+              for (const auto &[needle, replacement] : std_replacements) {
+                std::size_t position = 0;
+
+                while ((position = line.find(needle, position)) !=
+                       std::string::npos) {
+                  line.replace(position, needle.length(), replacement);
+                  position += replacement.length();
+                }
+              }
+
+              length_sum += line.length();
+            },
+            line_count),
+        "ns/line"};
+    benchmark_results["replace 32 needles absl::StrReplaceAll"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              length_sum +=
+                  absl::StrReplaceAll(lines[i], std_replacements).length();
+            },
+            line_count),
+        "ns/line"};
+
+    StringReplacer replacer(replacements);
+    String output;
+
+    benchmark_results["replace 32 needles StringReplacer"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              replacer.replace(lines[i], output);
+              length_sum += output.length();
+            },
+            line_count),
+        "ns/line"};
+    do_not_optimize(length_sum);
+
+    // both are leftmost longest, the timings are of the same output
+    int mismatch_count = 0;
+
+    for (const std::string &line : lines) {
+      replacer.replace(line, output);
+      mismatch_count +=
+          output != absl::StrReplaceAll(line, std_replacements) ? 1 : 0;
+    }
+
+    PXD_ASSERT(mismatch_count == 0);
+    benchmark_results["replace 32 needles absl mismatches"] = {
+        static_cast<double>(mismatch_count), "lines"};
+  }
+
+  void start_search_benchmark() {
+    // 16 MB of csv fields with 1-12 chars, the needle is not in the text
+    const std::size_t text_size = 16 * 1024 * 1024;
+    BenchmarkRandom rng;
+    std::string text;
+    text.reserve(text_size + 16);
+
+    while (text.size() < text_size) {
+      const int field_length = 1 + static_cast<int>(rng.next(12));
+
+      for (int i = 0; i < field_length; i++) {
+        text += static_cast<char>('a' + rng.next(26));
+      }
+
+      text += ',';
+    }
+
+    const std::string_view std_view = text;
+    const StringView view = text;
+    const std::string needle = "needle-absent";
+    std::size_t sum = 0;
+    BenchmarkTimer timer;
+
+    // bytes per nanosecond is GB/s
+    auto to_gb_per_s = [&](double elapsed_ns) {
+      return static_cast<double>(text.size()) / elapsed_ns;
+    };
+
+    sum += std_view.find(needle);
+    benchmark_results["search find std::string_view"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    sum += view.find(needle);
+    benchmark_results["search find StringView"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    sum += std_view.rfind(needle);
+    benchmark_results["search rfind std::string_view"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    sum += view.rfind(needle);
+    benchmark_results["search rfind StringView"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    sum += std::count(text.begin(), text.end(), ',');
+    benchmark_results["search count std::count"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    const std::size_t token_count = view.count(',') + 1;
+    benchmark_results["search count StringView"] = {
+        to_gb_per_s(timer.elapsed_ns()), "GB/s"};
+
+    timer.reset();
+    {
+      const std::vector<std::string> tokens = absl::StrSplit(text, ',');
+      sum += tokens.size();
+    }
+    benchmark_results["split absl::StrSplit std::string"] = {
+        timer.elapsed_ns() / token_count, "ns/token"};
+
+    timer.reset();
+    {
+      const std::vector<absl::string_view> tokens = absl::StrSplit(text, ',');
+      sum += tokens.size();
+    }
+    benchmark_results["split absl::StrSplit string_view"] = {
+        timer.elapsed_ns() / token_count, "ns/token"};
+
+    timer.reset();
+
+    for (StringView token : view.split(',')) {
+      sum += token.length();
+    }
+
+    benchmark_results["split StringView"] = {
+        timer.elapsed_ns() / token_count, "ns/token"};
+    do_not_optimize(sum);
+  }
+
+  void start_builder_benchmark() {
+    // user:<id>:session:<hex id>:<timestamp> cache keys, 57-67 chars
+    std::vector<std::uint64_t> ids(key_count);
+    BenchmarkRandom rng;
+
+    for (std::uint64_t &id : ids) {
+      id = rng.next();
+    }
+
+    const std::int64_t timestamp = 1'700'000'000'000;
+    std::size_t length_sum = 0;
+
+    benchmark_results["cache key String operator+"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              const String key = String("user:") + std::to_string(i) +
+                                 ":session:" +
+                                 absl::StrCat(absl::Hex(ids[i])) + ":" +
+                                 std::to_string(timestamp + i);
+              length_sum += key.length();
+            },
+            key_count),
+        "ns/op"};
+    benchmark_results["cache key absl::StrCat"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              const String key(absl::StrCat("user:", i, ":session:",
+                                            absl::Hex(ids[i]), ":",
+                                            timestamp + i));
+              length_sum += key.length();
+            },
+            key_count),
+        "ns/op"};
+    benchmark_results["cache key str::concat"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              const String key =
+                  str::concat("user:", i, ":session:", absl::Hex(ids[i]),
+                              ':', timestamp + i);
+              length_sum += key.length();
+            },
+            key_count),
+        "ns/op"};
+
+    StringBuilder builder;
+
+    benchmark_results["cache key StringBuilder view"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              builder.clear();
+              builder.append("user:", i, ":session:", absl::Hex(ids[i]), ':',
+                             timestamp + i);
+              length_sum += builder.view().length();
+            },
+            key_count),
+        "ns/op"};
+    do_not_optimize(length_sum);
+  }
+
+  /// @brief the second build is measured, the first one touches the memory
+  /// of the keys
+  template <typename Keys, typename Func>
+  auto measure_build(Keys &keys, Func &&func,
+                     StringArena *arena = nullptr) const -> double {
+    measure_ns_per_op(func, key_count);
+    keys.clear();
+
+    if (arena != nullptr) {
+      arena->reset();
+    }
+
+    return measure_ns_per_op(func, key_count);
+  }
+
+private:
+  int key_count = 1'000'000;
+};
+} // namespace pxd
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "thread_pool.hpp"
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class TopKBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {10'000'000, 100'000'000}) {
+      std::vector<float> scores(size);
+      BenchmarkRandom rng;
+
+      for (float &score : scores) {
+        score = static_cast<float>(rng.next(1 << 24)) / (1 << 24);
+      }
+
+      for (int k : {100, 10'000}) {
+        start_top_k_benchmark(scores, k);
+      }
+    }
+  }
+
+private:
+  void start_top_k_benchmark(const std::vector<float> &scores, int k) {
+    const int size = static_cast<int>(scores.size());
+    const std::string name = fmt::format("{:9d} scores k {:5d}", size, k);
+    std::vector<float> output(k);
+
+    benchmark_results[name + " partial sort copy"] = {
+        measure_ms([&] {
+          std::partial_sort_copy(scores.begin(), scores.end(), output.begin(),
+                                 output.end(), std::greater<float>());
+        }),
+        "ms"};
+
+    benchmark_results[name + " heap"] = {
+        measure_ms([&] {
+          do_not_optimize(
+              top_k(scores.data(), size, k, eTOP_K_ALGORITHM::HEAP).back());
+        }),
+        "ms"};
+
+    benchmark_results[name + " select"] = {
+        measure_ms([&] {
+          do_not_optimize(
+              top_k(scores.data(), size, k, eTOP_K_ALGORITHM::SELECT).back());
+        }),
+        "ms"};
+
+    ThreadPool &thread_pool = ThreadPool::get_default();
+
+    benchmark_results[name + fmt::format(" parallel {:2d} threads",
+                                         thread_pool.get_thread_count())] = {
+        measure_ms([&] {
+          do_not_optimize(
+              parallel_top_k(scores.data(), size, k, thread_pool).back());
+        }),
+        "ms"};
+  }
+
+  template <typename Func> static auto measure_ms(Func &&func) -> double {
+    return measure_ns_per_op([&](std::int64_t) { func(); }, 1) / 1'000'000.0;
+  }
+};
+} // namespace pxd
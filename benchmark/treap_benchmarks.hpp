@@ -0,0 +1,126 @@
+#pragma once
+
+#include "absl/btree_set.hpp"
+#include "benchmark_utils.hpp"
+#include "format.h" // fmt/format.h
+#include "randomized_treap.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class TreapBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {10'000, 1'000'000}) {
+      start_treap_benchmark(size);
+    }
+  }
+
+private:
+  void start_treap_benchmark(int size) {
+    const std::string name = fmt::format("{:7d} keys", size);
+
+    std::vector<int> sorted_keys(size);
+    std::vector<int> random_keys(size);
+    BenchmarkRandom rng;
+
+    for (int i = 0; i < size; i++) {
+      sorted_keys[i] = i * 2;
+      random_keys[i] = static_cast<int>(rng.next(size * 2));
+    }
+
+    RandomizedTreap<int> treap;
+    absl::btree_set<int> btree;
+
+    benchmark_results[name + " insert random treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) { treap.insert(random_keys[i]); }, size),
+        "ns/op"};
+    benchmark_results[name + " insert random btree set"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) { btree.insert(random_keys[i]); }, size),
+        "ns/op"};
+
+    benchmark_results[name + " build sorted treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) { treap.from_sorted(sorted_keys.data(), size); },
+            1) /
+            size,
+        "ns/key"};
+    benchmark_results[name + " build sorted btree set"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              btree = absl::btree_set<int>(sorted_keys.begin(),
+                                           sorted_keys.end());
+            },
+            1) /
+            size,
+        "ns/key"};
+
+    benchmark_results[name + " contains treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              do_not_optimize(treap.contains(random_keys[i]));
+            },
+            size),
+        "ns/op"};
+    benchmark_results[name + " contains btree set"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              do_not_optimize(btree.contains(random_keys[i]));
+            },
+            size),
+        "ns/op"};
+
+    // a 100 key window, the btree walks it with the iterators
+    benchmark_results[name + " range count treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              do_not_optimize(
+                  treap.range_count(random_keys[i], random_keys[i] + 200));
+            },
+            size),
+        "ns/op"};
+    benchmark_results[name + " range count btree set"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              do_not_optimize(
+                  std::distance(btree.lower_bound(random_keys[i]),
+                                btree.upper_bound(random_keys[i] + 200)));
+            },
+            size),
+        "ns/op"};
+
+    // the median, the btree has no order statistics
+    benchmark_results[name + " kth treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) { do_not_optimize(treap.kth(size / 2)); },
+            kth_count),
+        "ns/op"};
+    benchmark_results[name + " kth btree set"] = {
+        measure_ns_per_op(
+            [&](std::int64_t) {
+              do_not_optimize(*std::next(btree.begin(), size / 2));
+            },
+            kth_count),
+        "ns/op"};
+
+    RandomizedTreap<int> right_treap;
+
+    benchmark_results[name + " split join treap"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              right_treap = treap.split(sorted_keys[i]);
+              treap.join(std::move(right_treap));
+            },
+            size),
+        "ns/op"};
+  }
+
+private:
+  std::int64_t kth_count = 1'000;
+};
+} // namespace pxd
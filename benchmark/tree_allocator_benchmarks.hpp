@@ -0,0 +1,105 @@
+#pragma once
+
+#include "benchmark_utils.hpp"
+#include "binary_search_tree.hpp"
+#include "format.h" // fmt/format.h
+#include "node_allocator.hpp"
+#include "randomized_treap.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace pxd {
+class TreeAllocatorBenchmarks : public IBenchmark {
+public:
+  void start_benchmark() override {
+    for (int size : {100'000, 1'000'000}) {
+      BinarySearchTree<int> bst(eBST_BALANCE::AVL);
+      BinarySearchTree<int, PoolNodeAllocator> pooled_bst(eBST_BALANCE::AVL);
+      RandomizedTreap<int> treap;
+      RandomizedTreap<int, PoolNodeAllocator> pooled_treap;
+
+      start_tree_benchmark(bst, "bst avl", size);
+      start_tree_benchmark(pooled_bst, "pooled bst avl", size);
+      start_tree_benchmark(treap, "treap", size);
+      start_tree_benchmark(pooled_treap, "pooled treap", size);
+    }
+  }
+
+private:
+  template <template <typename> class NodeAllocator>
+  static void add_key(BinarySearchTree<int, NodeAllocator> &bst, int key) {
+    bst.add(key);
+  }
+  template <template <typename> class NodeAllocator>
+  static void add_key(RandomizedTreap<int, NodeAllocator> &treap, int key) {
+    treap.insert(key);
+  }
+
+  /// @brief the heap which is in use, 0 if the allocator does not tell it
+  static auto get_heap_bytes() noexcept -> std::size_t {
+#if defined(__GLIBC__)
+    const struct mallinfo2 info = mallinfo2();
+
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+  }
+
+  /// @brief the memory of a node with the allocator overhead after the
+  /// shuffled adds, the steady remove and add churn which recycles the nodes
+  /// and the release of the whole tree
+  template <typename Tree>
+  void start_tree_benchmark(Tree &tree, const std::string &tree_name,
+                            int size) {
+    const std::string name = fmt::format("{:7d} keys {}", size, tree_name);
+
+    std::vector<int> keys(size);
+    BenchmarkRandom rng;
+
+    for (int i = 0; i < size; i++) {
+      keys[i] = i;
+    }
+
+    for (int i = size - 1; i > 0; i--) {
+      std::swap(keys[i], keys[rng.next(i + 1)]);
+    }
+
+    const std::size_t start_bytes = get_heap_bytes();
+
+    for (int key : keys) {
+      add_key(tree, key);
+    }
+
+    const std::size_t end_bytes = get_heap_bytes();
+
+    if (end_bytes > start_bytes) {
+      benchmark_results[name + " memory per node"] = {
+          static_cast<double>(end_bytes - start_bytes) / size, "bytes"};
+    }
+
+    // every remove frees a node which the next add takes again
+    benchmark_results[name + " remove add churn"] = {
+        measure_ns_per_op(
+            [&](std::int64_t i) {
+              tree.remove(keys[i]);
+              add_key(tree, keys[i] + size);
+            },
+            size),
+        "ns/op"};
+
+    benchmark_results[name + " release"] = {
+        measure_ns_per_op([&](std::int64_t) { tree.release(); }, 1) /
+            1'000'000.0,
+        "ms"};
+  }
+};
+} // namespace pxd
@@ -9,6 +9,7 @@ if __name__ == "__main__":
         "btree_map": "container/btree_map.h",
         "btree_set": "container/btree_set.h",
         "hash": "hash/hash.h",
+        "int128": "numeric/int128.h",
         "random": "random/random.h",
         "str_strip": "strings/strip.h",
         "str_split": "strings/str_split.h",
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../../third-party/abseil-cpp/absl/numeric/int128.h"
@@ -2,7 +2,10 @@
 
 #include "../checks.hpp"
 #include "../utility.hpp"
+#include <algorithm>
 #include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace pxd {
 template <typename T> class Array {
@@ -70,17 +73,30 @@ public:
   /// @brief get index of the value
   /// @param value wanted value to be found
   /// @return index value if successful, if not INDEX_NONE
-  constexpr inline int where(T &value) noexcept { return find(*this, value); }
+  inline int where(const T &value) const noexcept {
+    return find<T>(arr_ptr, length, value);
+  }
 
-  /// @brief get index of the value
+  /// @brief get count of the values which are equal to the given value
+  /// @param value wanted value to be counted
+  /// @return count of the equal values
+  inline int count(const T &value) const noexcept {
+    return pxd::count<T>(arr_ptr, length, value);
+  }
+
+  /// @brief mark the values which are equal to the given value
   /// @param value wanted value to be found
-  /// @return index value if successful, if not INDEX_NONE
-  constexpr inline int where(T &&value) noexcept { return where(value); }
+  /// @param bitmap output, get_bitmap_word_count(length) words
+  /// @return count of the equal values
+  inline int find_all(const T &value, std::uint64_t *bitmap) const noexcept {
+    return pxd::find_all<T>(arr_ptr, length, value, bitmap);
+  }
 
   /// @brief resize array with contained values
   /// @param new_size wanted new size
   constexpr void resize(int new_size) {
     if (length == 0) {
+      release();
       allocate(new_size);
       return;
     }
@@ -90,12 +106,20 @@ public:
       return;
     }
 
-    T *temp_array = new T[length];
-    copy_full(arr_ptr, temp_array);
+    // move the values to the new array directly instead of copying them twice
+    // through a temporary array
+    T *new_array = new T[new_size];
+    const int move_count = length < new_size ? length : new_size;
 
-    reallocate(temp_array, new_size);
+    for (int i = 0; i < move_count; i++) {
+      new_array[i] = std::move(arr_ptr[i]);
+    }
 
-    delete[] temp_array;
+    delete[] arr_ptr;
+
+    arr_ptr = new_array;
+    length = new_size;
+    byte_size = new_size * sizeof(T);
   }
 
   /// @brief recreate the array from given raw array values
@@ -239,7 +263,11 @@ private:
     PXD_ASSERT(from != nullptr);
     PXD_ASSERT(to != nullptr);
 
-    std::memcpy(to, from, size);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      std::memcpy(to, from, size);
+    } else {
+      std::copy_n(from, size / sizeof(T), to);
+    }
   }
 
   /// @brief copy all the values of from array to to array
@@ -1,7 +1,13 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "node_allocator.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
 
 namespace pxd {
 enum class eBST_ORDER : std::uint8_t {
@@ -10,8 +16,15 @@ enum class eBST_ORDER : std::uint8_t {
   POSTORDER,
 };
 
+enum class eBST_BALANCE : std::uint8_t {
+  NONE, // the values are placed where the search ends, sorted adds make a list
+  AVL,  // the subtree heights differ by at most 1, O(log n) in the worst case
+};
+
 template <typename T> struct BSTNode {
   T value;
+  // height of the subtree, kept up to date by the AVL balance only
+  int height = 1;
   BSTNode<T> *left = nullptr;
   BSTNode<T> *right = nullptr;
 
@@ -28,30 +41,172 @@ template <typename T> struct BSTNode {
   auto has_right() noexcept -> bool { return right != nullptr; }
 };
 
-template <typename T> class BinarySearchTree {
+/// @brief forward iterator of the BST in the given order. The path which is
+/// not visited yet is kept in an explicit stack, so a deep tree does not
+/// recurse and the nodes are visited lazily
+/// @tparam T value type
+template <typename T> class BSTIterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
+
+public:
+  /// @brief the end iterator
+  BSTIterator() = default;
+  /// @param root root of the tree, the iterator starts at the first node of
+  /// the order
+  /// @param order the traversal order
+  BSTIterator(BSTNode<T> *root, eBST_ORDER order) : order(order) {
+    if (root == nullptr) {
+      return;
+    }
+
+    switch (order) {
+    case eBST_ORDER::INORDER:
+      push_left_path(root);
+      break;
+    case eBST_ORDER::PREORDER:
+      path.push_back(root);
+      break;
+    case eBST_ORDER::POSTORDER:
+      push_first_postorder_path(root);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  auto operator*() const -> reference { return path.back()->value; }
+  auto operator->() const -> pointer { return &path.back()->value; }
+
+  auto operator++() -> BSTIterator & {
+    PXD_ASSERT(!path.empty());
+
+    BSTNode<T> *node = path.back();
+    path.pop_back();
+
+    switch (order) {
+    case eBST_ORDER::INORDER:
+      push_left_path(node->right);
+      break;
+    case eBST_ORDER::PREORDER:
+      // the left child is on the top, it is visited first
+      if (node->right != nullptr) {
+        path.push_back(node->right);
+      }
+
+      if (node->left != nullptr) {
+        path.push_back(node->left);
+      }
+      break;
+    case eBST_ORDER::POSTORDER:
+      // the right subtree of the parent comes after its left subtree
+      if (!path.empty() && path.back()->left == node &&
+          path.back()->right != nullptr) {
+        push_first_postorder_path(path.back()->right);
+      }
+      break;
+
+    default:
+      break;
+    }
+
+    return *this;
+  }
+
+  auto operator++(int) -> BSTIterator {
+    BSTIterator old = *this;
+    ++(*this);
+
+    return old;
+  }
+
+  auto operator==(const BSTIterator &other) const noexcept -> bool {
+    return get_node() == other.get_node();
+  }
+  auto operator!=(const BSTIterator &other) const noexcept -> bool {
+    return get_node() != other.get_node();
+  }
+
+  /// @brief the current node, nullptr for the end
+  auto get_node() const noexcept -> BSTNode<T> * {
+    return path.empty() ? nullptr : path.back();
+  }
+
+private:
+  template <typename, template <typename> class>
+  friend class BinarySearchTree;
+
+  /// @brief the in order iterator which is set up by the bound searches
+  explicit BSTIterator(std::vector<BSTNode<T> *> &&_path)
+      : path(std::move(_path)) {}
+
+  void push_left_path(BSTNode<T> *node) {
+    while (node != nullptr) {
+      path.push_back(node);
+      node = node->left;
+    }
+  }
+
+  /// @brief go down to the first post order node of the subtree, the left
+  /// child if there is one, the right one otherwise
+  void push_first_postorder_path(BSTNode<T> *node) {
+    while (node != nullptr) {
+      path.push_back(node);
+      node = node->left != nullptr ? node->left : node->right;
+    }
+  }
+
+private:
+  std::vector<BSTNode<T> *> path;
+  eBST_ORDER order = eBST_ORDER::INORDER;
+};
+
+/// @brief BST of the unique values, unbalanced or AVL balanced
+/// @tparam T value type
+/// @tparam NodeAllocator allocator of the nodes, the PoolNodeAllocator keeps
+/// them in the contiguous chunks, recycles the removed ones and releases the
+/// trivially destructible ones at once
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class BinarySearchTree {
+public:
+  using iterator = BSTIterator<T>;
+  using Node = BSTNode<T>;
+
 public:
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
   // Constructors
 
   constexpr BinarySearchTree() noexcept = default;
+  constexpr explicit BinarySearchTree(eBST_BALANCE balance) noexcept
+      : balance(balance) {}
   BinarySearchTree(T *values, int size, bool is_balance = false) {
     from_array(values, size, is_balance);
   }
-  BinarySearchTree(const BinarySearchTree<T> &other) { from_bst(other); }
-  constexpr BinarySearchTree(BinarySearchTree<T> &&other) noexcept
-      : root(other.get_root()), total_node_count(other.get_total_node_count()) {
+  BinarySearchTree(const BinarySearchTree &other) { from_bst(other); }
+  constexpr BinarySearchTree(BinarySearchTree &&other) noexcept
+      : root(other.get_root()), total_node_count(other.get_total_node_count()),
+        balance(other.get_balance()),
+        node_allocator(std::move(other.node_allocator)) {
     other.exec_move();
   }
-  constexpr auto operator=(BinarySearchTree<T> &&other) -> BinarySearchTree & {
+  constexpr auto operator=(BinarySearchTree &&other) -> BinarySearchTree & {
     release();
 
     root = other.get_root();
     total_node_count = other.get_total_node_count();
+    balance = other.get_balance();
+    node_allocator = std::move(other.node_allocator);
     other.exec_move();
 
     return *this;
   }
-  auto operator=(const BinarySearchTree<T> &other) -> BinarySearchTree & {
+  auto operator=(const BinarySearchTree &other) -> BinarySearchTree & {
     if (other.get_root() == root) {
       return *this;
     }
@@ -64,10 +219,10 @@ public:
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
   // Operator Overloads
 
-  constexpr auto operator==(BinarySearchTree<T> &other) noexcept -> bool {
+  constexpr auto operator==(BinarySearchTree &other) noexcept -> bool {
     return other.get_root() == root;
   }
-  constexpr auto operator!=(BinarySearchTree<T> &other) noexcept -> bool {
+  constexpr auto operator!=(BinarySearchTree &other) noexcept -> bool {
     return other.get_root() != root;
   }
 
@@ -79,15 +234,35 @@ public:
       return;
     }
 
-    release_tree(root);
+    if constexpr (NodeAllocator<Node>::owns_nodes &&
+                  std::is_trivially_destructible_v<Node>) {
+      // the chunks are freed without a walk of the nodes
+      node_allocator.release_all();
+    } else {
+      release_tree(root);
+    }
 
     root = nullptr;
     total_node_count = 0;
   };
 
+  /// @brief reserve the nodes for the adds, only the pool allocators use it
+  void reserve(int node_count) { node_allocator.reserve(node_count); }
+
   void add(const T &value) {
+    if (balance == eBST_BALANCE::AVL) {
+      bool is_added = false;
+      root = add_avl(root, value, is_added);
+
+      if (is_added) {
+        total_node_count++;
+      }
+
+      return;
+    }
+
     if (!IS_VALID_PTR(root)) {
-      root = new BSTNode<T>();
+      root = node_allocator.allocate();
       root->value = value;
       total_node_count++;
       return;
@@ -97,7 +272,7 @@ public:
       return;
     }
 
-    BSTNode<T> *new_node = new BSTNode<T>();
+    BSTNode<T> *new_node = node_allocator.allocate();
     new_node->value = value;
 
     place_new_node(root, new_node);
@@ -108,45 +283,49 @@ public:
   void add(T &&value) { add(value); }
 
   void remove(const T &value) noexcept {
-    if (root == nullptr) {
-      return;
-    }
+    if (balance == eBST_BALANCE::AVL) {
+      bool is_removed = false;
+      root = remove_avl(root, value, is_removed);
+
+      if (is_removed) {
+        total_node_count--;
+      }
 
-    if (!is_contain(value)) {
       return;
     }
 
-    BSTNode<T> *current_node = root;
-    BSTNode<T> *parent_node = root;
+    BSTNode<T> **link = &root;
 
-    while (current_node->value != value) {
-      parent_node = current_node;
+    while (*link != nullptr && (*link)->value != value) {
+      link = value < (*link)->value ? &(*link)->left : &(*link)->right;
+    }
 
-      if (value < current_node->value) {
-        current_node = current_node->left;
-      } else if (value > current_node->value) {
-        current_node = current_node->right;
-      }
+    if (*link == nullptr) {
+      return;
     }
 
-    if (root == current_node) {
-      delete root;
-      root = nullptr;
+    BSTNode<T> *current_node = *link;
 
-      total_node_count = 0;
+    if (current_node->has_two_children()) {
+      // the smallest value of the right subtree takes the place of the node
+      BSTNode<T> **min_link = &current_node->right;
 
-      return;
-    }
+      while ((*min_link)->left != nullptr) {
+        min_link = &(*min_link)->left;
+      }
+
+      BSTNode<T> *min_node = *min_link;
+      *min_link = min_node->right;
 
-    if (current_node->has_one_child()) {
-      remove_from_one_child(current_node, parent_node);
-    } else if (current_node->has_two_children()) {
-      remove_from_two_children(current_node, parent_node);
-    } else if (current_node == root) {
-      remove_from_root(current_node, parent_node);
+      min_node->left = current_node->left;
+      min_node->right = current_node->right;
+      *link = min_node;
+    } else {
+      *link = current_node->has_left() ? current_node->left
+                                       : current_node->right;
     }
 
-    delete current_node;
+    node_allocator.deallocate(current_node);
     current_node = nullptr;
 
     total_node_count--;
@@ -154,7 +333,7 @@ public:
 
   void remove(T &&value) noexcept { remove(value); }
 
-  auto get_balanced_tree() -> BinarySearchTree<T> {
+  auto get_balanced_tree() -> BinarySearchTree {
     if (root == nullptr && total_node_count < 3) {
       return *this;
     }
@@ -162,7 +341,7 @@ public:
     T *values = new T[total_node_count];
     get_order(values, eBST_ORDER::INORDER);
 
-    BinarySearchTree<T> temp_bst;
+    BinarySearchTree temp_bst(balance);
     build_balanced_tree(temp_bst, values, 0, total_node_count - 1);
 
     delete[] values;
@@ -260,80 +439,110 @@ public:
     PXD_ASSERT(array != nullptr);
     int index = 0;
 
-    switch (order) {
-    case eBST_ORDER::INORDER:
-      inorder(root, array, index);
-      break;
-    case eBST_ORDER::PREORDER:
-      preorder(root, array, index);
-      break;
-    case eBST_ORDER::POSTORDER:
-      postorder(root, array, index);
-      break;
-
-    default:
-      break;
+    for (auto it = begin(order); it != end(); ++it) {
+      array[index] = *it;
+      index = index + 1;
     }
   }
 
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
-  // Inline Member Funcs
+  // Iterators
 
-  auto get_root() const noexcept -> BSTNode<T> * { return root; }
-  auto get_total_node_count() const noexcept -> int { return total_node_count; }
-  constexpr void exec_move() noexcept {
-    root = nullptr;
-    total_node_count = 0;
+  /// @brief iterator at the first node of the order, the nodes are visited
+  /// lazily. Adding or removing a value invalidates the iterators
+  /// @param order the traversal order
+  auto begin(eBST_ORDER order = eBST_ORDER::INORDER) const -> iterator {
+    return iterator(root, order);
   }
 
-private:
-  void inorder(BSTNode<T> *node, T *array, int &index) const noexcept {
-    if (node == nullptr) {
-      return;
-    }
+  auto end() const -> iterator { return iterator(); }
 
-    inorder(node->left, array, index);
+  /// @brief in order iterator at the first value which is not smaller than
+  /// the given value, the end if there is none
+  auto lower_bound(const T &value) const -> iterator {
+    std::vector<BSTNode<T> *> path;
+    BSTNode<T> *current_node = root;
 
-    array[index] = node->value;
-    index = index + 1;
+    // the nodes where the search goes left are visited after the subtree
+    while (current_node != nullptr) {
+      if (current_node->value < value) {
+        current_node = current_node->right;
+      } else {
+        path.push_back(current_node);
+        current_node = current_node->left;
+      }
+    }
 
-    inorder(node->right, array, index);
+    return iterator(std::move(path));
   }
 
-  void preorder(BSTNode<T> *node, T *array, int &index) const noexcept {
-    if (node == nullptr) {
-      return;
-    }
+  /// @brief in order iterator at the first value which is bigger than the
+  /// given value, the end if there is none
+  auto upper_bound(const T &value) const -> iterator {
+    std::vector<BSTNode<T> *> path;
+    BSTNode<T> *current_node = root;
 
-    array[index] = node->value;
-    index = index + 1;
+    while (current_node != nullptr) {
+      if (value < current_node->value) {
+        path.push_back(current_node);
+        current_node = current_node->left;
+      } else {
+        current_node = current_node->right;
+      }
+    }
 
-    preorder(node->left, array, index);
-    preorder(node->right, array, index);
+    return iterator(std::move(path));
   }
 
-  void postorder(BSTNode<T> *node, T *array, int &index) const noexcept {
-    if (node == nullptr) {
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Inline Member Funcs
+
+  /// @brief change the balance policy, the tree is rebuilt balanced when the
+  /// AVL balance is turned on
+  void set_balance(eBST_BALANCE new_balance) {
+    if (balance == new_balance) {
       return;
     }
 
-    postorder(node->left, array, index);
-    postorder(node->right, array, index);
+    balance = new_balance;
 
-    array[index] = node->value;
-    index = index + 1;
+    // the heights are not kept without the balance
+    if (balance == eBST_BALANCE::AVL && root != nullptr) {
+      balance_self();
+    }
   }
 
+  auto get_balance() const noexcept -> eBST_BALANCE { return balance; }
+  auto get_root() const noexcept -> BSTNode<T> * { return root; }
+  auto get_total_node_count() const noexcept -> int { return total_node_count; }
+  constexpr void exec_move() noexcept {
+    root = nullptr;
+    total_node_count = 0;
+  }
+
+private:
   void release_tree(BSTNode<T> *node) {
-    if (node == nullptr) {
-      return;
+    // explicit stack, an unbalanced tree can be as deep as its node count
+    std::vector<BSTNode<T> *> nodes;
+
+    if (node != nullptr) {
+      nodes.push_back(node);
     }
 
-    release_tree(node->left);
-    release_tree(node->right);
+    while (!nodes.empty()) {
+      BSTNode<T> *current_node = nodes.back();
+      nodes.pop_back();
+
+      if (current_node->left != nullptr) {
+        nodes.push_back(current_node->left);
+      }
+
+      if (current_node->right != nullptr) {
+        nodes.push_back(current_node->right);
+      }
 
-    delete node;
-    node = nullptr;
+      node_allocator.deallocate(current_node);
+    }
   }
 
   void construct_from_array(T *array, int node_size) {
@@ -344,7 +553,9 @@ private:
     }
   }
 
-  void from_bst(const BinarySearchTree<T> &other) {
+  void from_bst(const BinarySearchTree &other) {
+    balance = other.get_balance();
+
     const int node_size = other.get_total_node_count();
     T *others_values = new T[node_size];
 
@@ -355,7 +566,9 @@ private:
     delete[] others_values;
   }
 
-  void from_bst(BinarySearchTree<T> &&other) {
+  void from_bst(BinarySearchTree &&other) {
+    balance = other.get_balance();
+
     const int node_size = other.get_total_node_count();
     T *others_values = new T[node_size];
 
@@ -366,7 +579,7 @@ private:
     delete[] others_values;
   }
 
-  void build_balanced_tree(BinarySearchTree<T> &bst, T *values, int start,
+  void build_balanced_tree(BinarySearchTree &bst, T *values, int start,
                            int end) noexcept {
     if (start > end) {
       return;
@@ -415,62 +628,142 @@ private:
     }
   }
 
-  void remove_from_one_child(BSTNode<T> *current_node,
-                             BSTNode<T> *parent_node) noexcept {
-    if (parent_node->right == current_node) {
-      if (current_node->has_left()) {
-        parent_node->right = current_node->left;
-      } else {
-        parent_node->right = current_node->right;
-      }
-    } else if (parent_node->left == current_node) {
-      if (current_node->has_left()) {
-        parent_node->left = current_node->left;
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // AVL Balance
+
+  // the recursion is as deep as the tree, at most 1.44 log2(n) for AVL
+
+  auto add_avl(BSTNode<T> *node, const T &value, bool &is_added)
+      -> BSTNode<T> * {
+    if (node == nullptr) {
+      BSTNode<T> *new_node = node_allocator.allocate();
+      new_node->value = value;
+      is_added = true;
+
+      return new_node;
+    }
+
+    if (value < node->value) {
+      node->left = add_avl(node->left, value, is_added);
+    } else if (value > node->value) {
+      node->right = add_avl(node->right, value, is_added);
+    } else {
+      return node;
+    }
+
+    return rebalance(node);
+  }
+
+  auto remove_avl(BSTNode<T> *node, const T &value, bool &is_removed)
+      -> BSTNode<T> * {
+    if (node == nullptr) {
+      return nullptr;
+    }
+
+    if (value < node->value) {
+      node->left = remove_avl(node->left, value, is_removed);
+    } else if (value > node->value) {
+      node->right = remove_avl(node->right, value, is_removed);
+    } else {
+      is_removed = true;
+
+      BSTNode<T> *new_node = nullptr;
+
+      if (node->has_two_children()) {
+        // the smallest node of the right subtree takes the place of the node
+        BSTNode<T> *right = detach_min(node->right, new_node);
+        new_node->left = node->left;
+        new_node->right = right;
+        new_node = rebalance(new_node);
       } else {
-        parent_node->left = current_node->right;
+        new_node = node->has_left() ? node->left : node->right;
       }
+
+      node_allocator.deallocate(node);
+
+      return new_node;
     }
+
+    return rebalance(node);
   }
 
-  void remove_from_two_children(BSTNode<T> *current_node,
-                                BSTNode<T> *parent_node) noexcept {
-    if (parent_node->left == current_node && current_node->left->has_right()) {
-      BSTNode<T> *new_node = current_node->left;
-      place_new_node(current_node->right, new_node->right);
-      new_node->right = current_node->right;
-      parent_node->left = new_node;
-    } else if (parent_node->right == current_node &&
-               current_node->right->has_left()) {
-      BSTNode<T> *new_node = current_node->right;
-      place_new_node(current_node->left, new_node->left);
-      new_node->left = current_node->left;
-      parent_node->right = new_node;
+  /// @brief take the smallest node out of the subtree
+  /// @return the new root of the subtree
+  static auto detach_min(BSTNode<T> *node, BSTNode<T> *&min_node)
+      -> BSTNode<T> * {
+    if (node->left == nullptr) {
+      min_node = node;
+      return node->right;
     }
+
+    node->left = detach_min(node->left, min_node);
+
+    return rebalance(node);
   }
 
-  void remove_from_root(BSTNode<T> *current_node,
-                        BSTNode<T> *parent_node) noexcept {
-    if (current_node->has_two_children()) {
-      BSTNode<T> *new_node = current_node->right;
-      place_new_node(new_node, current_node->left);
-      root = new_node;
-    } else if (current_node->has_one_child()) {
-      if (current_node->has_left()) {
-        root = current_node->left;
-      } else {
-        root = current_node->right;
+  /// @brief rotate the node if its subtree heights differ by 2
+  /// @return the new root of the subtree
+  static auto rebalance(BSTNode<T> *node) noexcept -> BSTNode<T> * {
+    update_height(node);
+
+    const int balance_factor = get_height(node->left) - get_height(node->right);
+
+    if (balance_factor > 1) {
+      // left right case, the inner grandchild is the higher one
+      if (get_height(node->left->left) < get_height(node->left->right)) {
+        node->left = rotate_left(node->left);
       }
+
+      return rotate_right(node);
     }
 
-    if (parent_node->left == current_node) {
-      parent_node->left = nullptr;
-    } else if (parent_node->right == current_node) {
-      parent_node->right = nullptr;
+    if (balance_factor < -1) {
+      if (get_height(node->right->right) < get_height(node->right->left)) {
+        node->right = rotate_right(node->right);
+      }
+
+      return rotate_left(node);
     }
+
+    return node;
+  }
+
+  /// @brief the left child becomes the root of the subtree
+  static auto rotate_right(BSTNode<T> *node) noexcept -> BSTNode<T> * {
+    BSTNode<T> *left = node->left;
+    node->left = left->right;
+    left->right = node;
+
+    update_height(node);
+    update_height(left);
+
+    return left;
+  }
+
+  /// @brief the right child becomes the root of the subtree
+  static auto rotate_left(BSTNode<T> *node) noexcept -> BSTNode<T> * {
+    BSTNode<T> *right = node->right;
+    node->right = right->left;
+    right->left = node;
+
+    update_height(node);
+    update_height(right);
+
+    return right;
+  }
+
+  static auto get_height(const BSTNode<T> *node) noexcept -> int {
+    return node != nullptr ? node->height : 0;
+  }
+  static void update_height(BSTNode<T> *node) noexcept {
+    node->height =
+        std::max(get_height(node->left), get_height(node->right)) + 1;
   }
 
 private:
   BSTNode<T> *root = nullptr;
   int total_node_count = 0;
+  eBST_BALANCE balance = eBST_BALANCE::NONE;
+  NodeAllocator<Node> node_allocator;
 };
 } // namespace pxd
\ No newline at end of file
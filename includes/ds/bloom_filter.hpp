@@ -1,73 +1,279 @@
 #pragma once
 
-#include "../hash.hpp"
+#include "../checks.hpp"
+#include "../simd.hpp"
 
 #include "../absl/hash.hpp"
+#include "../absl/int128.hpp"
 
-#include <array>
-#include <bitset>
+#include <algorithm>
+#include <bit>
 #include <cmath>
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace pxd {
 
-constexpr int PXD_BLOOM_FILTER_MAX_BIT_SIZE = 1024; // 128 bytes
+constexpr std::uint64_t PXD_BLOOM_FILTER_DEFAULT_BIT_SIZE = 1024; // 128 bytes
+constexpr int PXD_BLOOM_FILTER_DEFAULT_HASH_COUNT = 3;
+constexpr int PXD_BLOOM_FILTER_MAX_HASH_COUNT = 32;
+// the values of a batch are hashed and their words prefetched before the
+// bits are touched, so the cache misses of the batch overlap
+constexpr int PXD_BLOOM_FILTER_BATCH_SIZE = 16;
+// odd 64 bit constant (2^64 / golden ratio), the 128 bit product of the hash
+// with it is the second hash of the double hashing
+constexpr std::uint64_t PXD_BLOOM_FILTER_HASH_MULTIPLIER =
+    0x9E3779B97F4A7C15ULL;
 
-template <int N = PXD_BLOOM_FILTER_MAX_BIT_SIZE> class BloomFilter {
+/// @brief probabilistic set, contains never misses an added value and finds
+/// a value which was not added with the false positive rate. The k bit
+/// indices come from a single hash with the Kirsch-Mitzenmacher double
+/// hashing, g_i = h1 + i * h2, which keeps the false positive rate of k
+/// independent hashes
+class BloomFilter {
 public:
-  BloomFilter() = default;
+  /// @brief PXD_BLOOM_FILTER_DEFAULT_BIT_SIZE bits and 3 hashes
+  BloomFilter() : BloomFilter(PXD_BLOOM_FILTER_DEFAULT_BIT_SIZE) {}
+  /// @param bit_count bit count of the filter, rounded up to 64 bits
+  /// @param hash_count k, the bit count of a value
+  explicit BloomFilter(std::uint64_t bit_count,
+                       int hash_count = PXD_BLOOM_FILTER_DEFAULT_HASH_COUNT) {
+    init(bit_count, hash_count);
+  }
   BloomFilter(const BloomFilter &other) = default;
   auto operator=(const BloomFilter &other) -> BloomFilter & = default;
   BloomFilter(BloomFilter &&other) = default;
   auto operator=(BloomFilter &&other) -> BloomFilter & = default;
   ~BloomFilter() = default;
 
-  template <typename T> void add(T value) {
-    std::array<int, 3> indices;
+  /// @brief the filter of the optimal size for the expected value count
+  /// @param expected_count n, the value count which is going to be added, 0
+  /// is taken as 1
+  /// @param false_positive_rate p, clamped into (0, 1)
+  static auto for_false_positive_rate(std::uint64_t expected_count,
+                                      double false_positive_rate)
+      -> BloomFilter {
+    const std::uint64_t bit_count =
+        get_optimal_bit_count(expected_count, false_positive_rate);
+
+    return BloomFilter(bit_count,
+                       get_optimal_hash_count(expected_count, bit_count));
+  }
+
+  /// @brief m = ceil(-n ln(p) / ln(2)^2), computed in double, it is exact
+  /// far beyond the 32 bit counts. The arguments are guarded in the release
+  /// builds too, a rate of 0 or 1 would make m infinite or 0, so n is at
+  /// least 1, p is clamped into (0, 1) and m is at least 1
+  static auto get_optimal_bit_count(std::uint64_t expected_count,
+                                    double false_positive_rate)
+      -> std::uint64_t {
+    const double ln2 = std::log(2.0);
+    const double bit_count =
+        std::ceil(-static_cast<double>(std::max<std::uint64_t>(
+                      expected_count, 1)) *
+                  std::log(clamp_false_positive_rate(false_positive_rate)) /
+                  (ln2 * ln2));
+
+    // the conversion of a value out of the 64 bit range is undefined
+    if (!(bit_count < 0x1p64)) {
+      return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    return std::max<std::uint64_t>(static_cast<std::uint64_t>(bit_count), 1);
+  }
 
-    calc_hash_indices<T>(std::forward<T>(value), indices);
+  /// @brief k = round(m / n ln(2)), n is at least 1 and k is in
+  /// [1, PXD_BLOOM_FILTER_MAX_HASH_COUNT]
+  static auto get_optimal_hash_count(std::uint64_t expected_count,
+                                     std::uint64_t bit_count) -> int {
+    const double hash_count =
+        static_cast<double>(bit_count) /
+        static_cast<double>(std::max<std::uint64_t>(expected_count, 1)) *
+        std::log(2.0);
 
-    filter[indices[0]] = true;
-    filter[indices[1]] = true;
-    filter[indices[2]] = true;
+    return static_cast<int>(std::lround(std::clamp(
+        hash_count, 1.0,
+        static_cast<double>(PXD_BLOOM_FILTER_MAX_HASH_COUNT))));
   }
 
-  template <typename T> auto contains(T value) -> bool {
-    std::array<int, 3> indices;
+  template <typename T> void add(const T &value) {
+    const HashPair hash = get_hash(value);
 
-    calc_hash_indices<T>(std::forward<T>(value), indices);
+    for (int i = 0; i < hash_count; i++) {
+      set_bit(get_index(hash, i));
+    }
+  }
 
-    bool is_contains = true;
+  template <typename T> auto contains(const T &value) const -> bool {
+    const HashPair hash = get_hash(value);
 
-    is_contains = is_contains && filter[indices[0]];
-    is_contains = is_contains && filter[indices[1]];
-    is_contains = is_contains && filter[indices[2]];
+    for (int i = 0; i < hash_count; i++) {
+      if (!test_bit(get_index(hash, i))) {
+        return false;
+      }
+    }
 
-    return is_contains;
+    return true;
   }
 
+  /// @brief add the values, the hashes of a batch are computed and their
+  /// words are prefetched before any bit is set
+  /// @param values the values
+  /// @param size value count
+  template <typename T> void add_batch(const T *values, std::size_t size) {
+    BatchIndices indices;
+
+    for (std::size_t start = 0; start < size;
+         start += PXD_BLOOM_FILTER_BATCH_SIZE) {
+      const int count = get_batch_count(size - start);
+
+      prepare_batch(values + start, count, indices);
+
+      for (int j = 0; j < count; j++) {
+        for (int i = 0; i < hash_count; i++) {
+          set_bit(indices[j][i]);
+        }
+      }
+    }
+  }
+
+  /// @brief check the values, the hashes of a batch are computed and their
+  /// words are prefetched before any bit is read. The bits of a value are
+  /// and-ed without a branch
+  /// @param values the values
+  /// @param size value count
+  /// @param results contains result of every value, size elements
+  template <typename T>
+  void contains_batch(const T *values, std::size_t size,
+                      bool *results) const {
+    BatchIndices indices;
+
+    for (std::size_t start = 0; start < size;
+         start += PXD_BLOOM_FILTER_BATCH_SIZE) {
+      const int count = get_batch_count(size - start);
+
+      prepare_batch(values + start, count, indices);
+
+      for (int j = 0; j < count; j++) {
+        bool is_contains = true;
+
+        for (int i = 0; i < hash_count; i++) {
+          is_contains &= test_bit(indices[j][i]);
+        }
+
+        results[start + j] = is_contains;
+      }
+    }
+  }
+
+  /// @brief remove all the values
+  void clear() noexcept { std::fill(words.begin(), words.end(), 0); }
+
+  /// @brief the false positive rate for the current fill,
+  /// (set bits / bit count)^k
+  auto get_false_positive_rate() const noexcept -> double {
+    std::uint64_t set_bit_count = 0;
+
+    for (std::uint64_t word : words) {
+      set_bit_count += std::popcount(word);
+    }
+
+    return std::pow(static_cast<double>(set_bit_count) /
+                        static_cast<double>(bit_count),
+                    hash_count);
+  }
+
+  auto get_bit_count() const noexcept -> std::uint64_t { return bit_count; }
+  auto get_hash_count() const noexcept -> int { return hash_count; }
+
 private:
+  struct HashPair {
+    std::uint64_t first;
+    std::uint64_t second;
+  };
+
+  using BatchIndices = std::uint64_t[PXD_BLOOM_FILTER_BATCH_SIZE]
+                                    [PXD_BLOOM_FILTER_MAX_HASH_COUNT];
+
+  void init(std::uint64_t new_bit_count, int new_hash_count) {
+    // at least a word, the index of a value is taken from the bit count
+    const std::uint64_t word_count =
+        new_bit_count / 64 + (new_bit_count % 64 != 0 ? 1 : 0);
+
+    words.assign(static_cast<std::size_t>(std::max<std::uint64_t>(
+                     word_count, 1)),
+                 0);
+    bit_count = words.size() * 64;
+    hash_count =
+        std::clamp(new_hash_count, 1, PXD_BLOOM_FILTER_MAX_HASH_COUNT);
+  }
+
+  /// @brief the 64 bit absl hash is widened to 128 bits with a multiply, the
+  /// low half is h1 and the high half is h2. h2 is odd so the indices of a
+  /// value never collapse to one
+  template <typename T> static auto get_hash(const T &value) -> HashPair {
+    const absl::uint128 hash =
+        absl::uint128(absl::Hash<T>{}(value)) *
+        PXD_BLOOM_FILTER_HASH_MULTIPLIER;
+
+    return {absl::Uint128Low64(hash), absl::Uint128High64(hash) | 1};
+  }
+
+  /// @brief g_i = h1 + i * h2 mapped to [0, bit_count) with a multiply and a
+  /// shift instead of a modulo
+  auto get_index(const HashPair &hash, int i) const noexcept
+      -> std::uint64_t {
+    const std::uint64_t combined_hash =
+        hash.first + static_cast<std::uint64_t>(i) * hash.second;
+
+    return absl::Uint128High64(absl::uint128(combined_hash) * bit_count);
+  }
+
+  /// @brief the value count of the batch which starts with the given
+  /// remaining value count
+  static auto get_batch_count(std::size_t remaining_count) noexcept -> int {
+    return remaining_count <
+                   static_cast<std::size_t>(PXD_BLOOM_FILTER_BATCH_SIZE)
+               ? static_cast<int>(remaining_count)
+               : PXD_BLOOM_FILTER_BATCH_SIZE;
+  }
+
+  /// @brief p clamped into (0, 1), NaN is taken as the lowest rate
+  static auto clamp_false_positive_rate(double false_positive_rate) noexcept
+      -> double {
+    if (!(false_positive_rate > 0.0)) {
+      return std::numeric_limits<double>::min();
+    }
+
+    return std::min(false_positive_rate, std::nextafter(1.0, 0.0));
+  }
+
+  /// @brief compute the bit indices of the values and prefetch their words
   template <typename T>
-  void calc_hash_indices(T &&value, std::array<int, 3> &indices) {
-    auto absl_hash_value = absl::Hash<T>{}(value);
-    auto std_hash_value = std::hash<T>{}(value);
-
-    auto temp_str = std::to_string(absl_hash_value);
-    uint8_t blake_comp_hashes[32] = {0};
-    comp_hash(temp_str.c_str(), temp_str.length(), blake_comp_hashes);
-
-    size_t blake_hash_value = 0;
-    for (int i = 0; i < 32; ++i) {
-      blake_hash_value +=
-          (size_t)(blake_comp_hashes[i]) * (size_t)(std::pow(2, i));
+  void prepare_batch(const T *values, int count,
+                     BatchIndices &indices) const {
+    for (int j = 0; j < count; j++) {
+      const HashPair hash = get_hash(values[j]);
+
+      for (int i = 0; i < hash_count; i++) {
+        indices[j][i] = get_index(hash, i);
+        PXD_PREFETCH(words.data() + indices[j][i] / 64);
+      }
     }
+  }
 
-    indices[0] = absl_hash_value % N;
-    indices[1] = std_hash_value % N;
-    indices[2] = blake_hash_value % N;
+  void set_bit(std::uint64_t index) noexcept {
+    words[index / 64] |= std::uint64_t(1) << (index % 64);
+  }
+  auto test_bit(std::uint64_t index) const noexcept -> bool {
+    return (words[index / 64] >> (index % 64)) & 1;
   }
 
 private:
-  std::bitset<N> filter;
+  std::vector<std::uint64_t> words;
+  std::uint64_t bit_count = 0;
+  int hash_count = PXD_BLOOM_FILTER_DEFAULT_HASH_COUNT;
 };
-} // namespace pxd
\ No newline at end of file
+} // namespace pxd
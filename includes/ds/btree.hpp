@@ -0,0 +1,504 @@
+#pragma once
+
+#include "../checks.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace pxd {
+
+/// @brief node of the BTree, the leaves do not use the children
+/// @tparam T value type
+/// @tparam Fanout max children count of a node
+template <typename T, int Fanout> struct BTreeNode {
+  T keys[Fanout - 1];
+  BTreeNode<T, Fanout> *children[Fanout];
+  int count = 0;
+  bool is_leaf = true;
+};
+
+/// @brief in memory B-tree set. A node keeps up to Fanout - 1 sorted keys
+/// in an array, so a lookup reads log_Fanout(n) nodes instead of the
+/// log_2(n) nodes of a BST. The nodes are split on the way down of an insert
+/// and filled up on the way down of a remove, both are a single pass
+/// @tparam T value type, compared with <
+/// @tparam Fanout max children count of a node, even, the smaller ones fit
+/// in fewer cache lines and the bigger ones make the tree shorter
+template <typename T, int Fanout = 16> class BTree {
+  static_assert(Fanout >= 4 && Fanout % 2 == 0,
+                "BTree fanout has to be an even number >= 4");
+
+public:
+  using Node = BTreeNode<T, Fanout>;
+
+  // the minimum degree, every node except the root has at least
+  // min_degree - 1 keys
+  static constexpr int min_degree = Fanout / 2;
+  static constexpr int max_key_count = Fanout - 1;
+
+public:
+  BTree() = default;
+  BTree(const BTree<T, Fanout> &other)
+      : root(copy_nodes(other.root)), size(other.size) {}
+  auto operator=(const BTree<T, Fanout> &other) -> BTree & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+    root = copy_nodes(other.root);
+    size = other.size;
+
+    return *this;
+  }
+  BTree(BTree<T, Fanout> &&other) noexcept
+      : root(other.root), size(other.size) {
+    other.exec_move();
+  }
+  auto operator=(BTree<T, Fanout> &&other) noexcept -> BTree & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+    root = other.root;
+    size = other.size;
+    other.exec_move();
+
+    return *this;
+  }
+  ~BTree() noexcept { release(); }
+
+  void release() noexcept {
+    release_nodes(root);
+    exec_move();
+  }
+
+  /// @brief insert the key, the full nodes on the path are split before
+  /// they are entered so a split never goes up
+  /// @param key the key
+  /// @return false if the key is in the tree already
+  auto insert(const T &key) -> bool {
+    if (root == nullptr) {
+      root = new Node();
+    }
+
+    if (root->count == max_key_count) {
+      Node *new_root = new Node();
+      new_root->is_leaf = false;
+      new_root->children[0] = root;
+      root = new_root;
+
+      split_child(root, 0);
+    }
+
+    Node *node = root;
+
+    while (true) {
+      int index = get_lower_index(node, key);
+
+      if (index < node->count && !(key < node->keys[index])) {
+        return false;
+      }
+
+      if (node->is_leaf) {
+        insert_key(node, index, key);
+        size++;
+
+        return true;
+      }
+
+      if (node->children[index]->count == max_key_count) {
+        split_child(node, index);
+
+        if (node->keys[index] < key) {
+          index++;
+        } else if (!(key < node->keys[index])) {
+          return false;
+        }
+      }
+
+      node = node->children[index];
+    }
+  }
+
+  /// @brief remove the key, the nodes on the path get at least min_degree
+  /// keys from a sibling or with a merge before they are entered, so the
+  /// leaf can give a key away
+  /// @param key the key
+  /// @return true if the key was in the tree
+  auto remove(const T &key) -> bool {
+    if (root == nullptr) {
+      return false;
+    }
+
+    const bool is_removed = remove_from(root, key);
+
+    // the root lost its last key with a merge of its two children
+    if (root->count == 0) {
+      Node *old_root = root;
+      root = root->is_leaf ? nullptr : root->children[0];
+
+      delete old_root;
+    }
+
+    if (is_removed) {
+      size--;
+    }
+
+    return is_removed;
+  }
+
+  /// @brief the smallest key which is not smaller than the given key
+  /// @return pointer to the key in the tree, nullptr if all the keys are
+  /// smaller. It is valid until the next insert or remove
+  auto lower_bound(const T &key) const noexcept -> const T * {
+    const T *result = nullptr;
+    Node *node = root;
+
+    while (node != nullptr) {
+      const int index = get_lower_index(node, key);
+
+      if (index < node->count) {
+        result = &node->keys[index];
+      }
+
+      node = node->is_leaf ? nullptr : node->children[index];
+    }
+
+    return result;
+  }
+
+  auto contains(const T &key) const noexcept -> bool {
+    Node *node = root;
+
+    while (node != nullptr) {
+      const int index = get_lower_index(node, key);
+
+      if (index < node->count && !(key < node->keys[index])) {
+        return true;
+      }
+
+      node = node->is_leaf ? nullptr : node->children[index];
+    }
+
+    return false;
+  }
+
+  /// @brief call the function with every key in the ascending order
+  template <typename Func> void for_each(Func &&func) const {
+    for_each_in(root, func);
+  }
+
+  auto get_height() const noexcept -> int {
+    int height = 0;
+
+    for (Node *node = root; node != nullptr;
+         node = node->is_leaf ? nullptr : node->children[0]) {
+      height++;
+    }
+
+    return height;
+  }
+
+  auto get_size() const noexcept -> int { return size; }
+  auto is_empty() const noexcept -> bool { return size == 0; }
+
+private:
+  void exec_move() noexcept {
+    root = nullptr;
+    size = 0;
+  }
+
+  /// @brief the count of the keys which are smaller than the key, the
+  /// position of the key or of the child which may have it
+  static auto get_lower_index(const Node *node, const T &key) noexcept
+      -> int {
+    if constexpr (Fanout <= 64) {
+      // a branchless scan of a few cache lines beats the mispredicted
+      // branches of a binary search
+      int index = 0;
+
+      for (int i = 0; i < node->count; i++) {
+        index += node->keys[i] < key;
+      }
+
+      return index;
+    } else {
+      return static_cast<int>(
+          std::lower_bound(node->keys, node->keys + node->count, key) -
+          node->keys);
+    }
+  }
+
+  static void insert_key(Node *node, int index, const T &key) {
+    for (int i = node->count; i > index; i--) {
+      node->keys[i] = std::move(node->keys[i - 1]);
+    }
+
+    node->keys[index] = key;
+    node->count++;
+  }
+
+  /// @brief split the full child, its median key goes up to the parent
+  static void split_child(Node *parent, int index) {
+    Node *child = parent->children[index];
+    Node *sibling = new Node();
+    sibling->is_leaf = child->is_leaf;
+    sibling->count = min_degree - 1;
+
+    for (int i = 0; i < min_degree - 1; i++) {
+      sibling->keys[i] = std::move(child->keys[i + min_degree]);
+    }
+
+    if (!child->is_leaf) {
+      for (int i = 0; i < min_degree; i++) {
+        sibling->children[i] = child->children[i + min_degree];
+      }
+    }
+
+    child->count = min_degree - 1;
+
+    for (int i = parent->count; i > index; i--) {
+      parent->keys[i] = std::move(parent->keys[i - 1]);
+      parent->children[i + 1] = parent->children[i];
+    }
+
+    parent->keys[index] = std::move(child->keys[min_degree - 1]);
+    parent->children[index + 1] = sibling;
+    parent->count++;
+  }
+
+  static auto remove_from(Node *node, const T &removed_key) -> bool {
+    T key = removed_key;
+
+    while (true) {
+      int index = get_lower_index(node, key);
+      const bool is_found = index < node->count && !(key < node->keys[index]);
+
+      if (node->is_leaf) {
+        if (!is_found) {
+          return false;
+        }
+
+        for (int i = index; i < node->count - 1; i++) {
+          node->keys[i] = std::move(node->keys[i + 1]);
+        }
+
+        node->count--;
+
+        return true;
+      }
+
+      if (is_found) {
+        Node *left = node->children[index];
+        Node *right = node->children[index + 1];
+
+        // the key is replaced with its neighbour which is removed from the
+        // child instead
+        if (left->count >= min_degree) {
+          node->keys[index] = get_max_key(left);
+          key = node->keys[index];
+          node = left;
+        } else if (right->count >= min_degree) {
+          node->keys[index] = get_min_key(right);
+          key = node->keys[index];
+          node = right;
+        } else {
+          merge_children(node, index);
+          node = left;
+        }
+
+        continue;
+      }
+
+      if (node->children[index]->count < min_degree) {
+        index = fill_child(node, index);
+      }
+
+      node = node->children[index];
+    }
+  }
+
+  /// @brief give the child at least min_degree keys with a rotation from a
+  /// sibling or a merge with a sibling
+  /// @return the index of the child which has the keys of the given child
+  static auto fill_child(Node *parent, int index) -> int {
+    if (index > 0 && parent->children[index - 1]->count >= min_degree) {
+      rotate_right(parent, index - 1);
+      return index;
+    }
+
+    if (index < parent->count &&
+        parent->children[index + 1]->count >= min_degree) {
+      rotate_left(parent, index);
+      return index;
+    }
+
+    if (index < parent->count) {
+      merge_children(parent, index);
+      return index;
+    }
+
+    merge_children(parent, index - 1);
+
+    return index - 1;
+  }
+
+  /// @brief move the last key of the left child up and the parent key down
+  /// to the right child
+  static void rotate_right(Node *parent, int index) {
+    Node *left = parent->children[index];
+    Node *right = parent->children[index + 1];
+
+    for (int i = right->count; i > 0; i--) {
+      right->keys[i] = std::move(right->keys[i - 1]);
+    }
+
+    if (!right->is_leaf) {
+      for (int i = right->count + 1; i > 0; i--) {
+        right->children[i] = right->children[i - 1];
+      }
+
+      right->children[0] = left->children[left->count];
+    }
+
+    right->keys[0] = std::move(parent->keys[index]);
+    parent->keys[index] = std::move(left->keys[left->count - 1]);
+
+    right->count++;
+    left->count--;
+  }
+
+  /// @brief move the first key of the right child up and the parent key down
+  /// to the left child
+  static void rotate_left(Node *parent, int index) {
+    Node *left = parent->children[index];
+    Node *right = parent->children[index + 1];
+
+    left->keys[left->count] = std::move(parent->keys[index]);
+
+    if (!left->is_leaf) {
+      left->children[left->count + 1] = right->children[0];
+
+      for (int i = 0; i < right->count; i++) {
+        right->children[i] = right->children[i + 1];
+      }
+    }
+
+    parent->keys[index] = std::move(right->keys[0]);
+
+    for (int i = 0; i < right->count - 1; i++) {
+      right->keys[i] = std::move(right->keys[i + 1]);
+    }
+
+    left->count++;
+    right->count--;
+  }
+
+  /// @brief merge the right child and the parent key into the left child,
+  /// both children have min_degree - 1 keys
+  static void merge_children(Node *parent, int index) {
+    Node *left = parent->children[index];
+    Node *right = parent->children[index + 1];
+
+    left->keys[left->count] = std::move(parent->keys[index]);
+
+    for (int i = 0; i < right->count; i++) {
+      left->keys[left->count + 1 + i] = std::move(right->keys[i]);
+    }
+
+    if (!left->is_leaf) {
+      for (int i = 0; i <= right->count; i++) {
+        left->children[left->count + 1 + i] = right->children[i];
+      }
+    }
+
+    left->count += right->count + 1;
+
+    for (int i = index; i < parent->count - 1; i++) {
+      parent->keys[i] = std::move(parent->keys[i + 1]);
+      parent->children[i + 1] = parent->children[i + 2];
+    }
+
+    parent->count--;
+
+    delete right;
+  }
+
+  static auto get_max_key(const Node *node) -> const T & {
+    while (!node->is_leaf) {
+      node = node->children[node->count];
+    }
+
+    return node->keys[node->count - 1];
+  }
+
+  static auto get_min_key(const Node *node) -> const T & {
+    while (!node->is_leaf) {
+      node = node->children[0];
+    }
+
+    return node->keys[0];
+  }
+
+  template <typename Func>
+  static void for_each_in(const Node *node, Func &func) {
+    if (node == nullptr) {
+      return;
+    }
+
+    for (int i = 0; i < node->count; i++) {
+      if (!node->is_leaf) {
+        for_each_in(node->children[i], func);
+      }
+
+      func(node->keys[i]);
+    }
+
+    if (!node->is_leaf) {
+      for_each_in(node->children[node->count], func);
+    }
+  }
+
+  static auto copy_nodes(const Node *node) -> Node * {
+    if (node == nullptr) {
+      return nullptr;
+    }
+
+    Node *new_node = new Node();
+    new_node->is_leaf = node->is_leaf;
+    new_node->count = node->count;
+
+    for (int i = 0; i < node->count; i++) {
+      new_node->keys[i] = node->keys[i];
+    }
+
+    if (!node->is_leaf) {
+      for (int i = 0; i <= node->count; i++) {
+        new_node->children[i] = copy_nodes(node->children[i]);
+      }
+    }
+
+    return new_node;
+  }
+
+  static void release_nodes(Node *node) noexcept {
+    if (node == nullptr) {
+      return;
+    }
+
+    if (!node->is_leaf) {
+      for (int i = 0; i <= node->count; i++) {
+        release_nodes(node->children[i]);
+      }
+    }
+
+    delete node;
+  }
+
+private:
+  Node *root = nullptr;
+  int size = 0;
+};
+} // namespace pxd
@@ -3,6 +3,12 @@
 #include "../checks.hpp"
 #include "../utility.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace pxd {
 
 template <typename T, int D = 4, bool is_max_heap = true> class DHeap {
@@ -18,53 +24,50 @@ public:
   inline void release() noexcept { values.clear(); }
 
   decltype(auto) operator[](int index) { return values[index]; }
+  decltype(auto) operator[](int index) const { return values[index]; }
 
   /// @brief insert new element, height of tree affects its performance
   /// @param element new element
-  void insert(T &element) {
+  void insert(const T &element) {
     values.push_back(element);
     ascend(values.size() - 1);
   }
 
   /// @brief insert new element, height of tree affects its performance
-  /// @param element new element
-  inline void insert(T &&element) { insert(element); }
-
-  void remove(T &value) {
-    const int current_length = values.size();
-
-    int index = find_index(values, value);
-
-    if (index < 0) {
-      return;
-    }
-
-    if (index == 0 && current_length == 1) {
-      values.clear();
-      return;
-    }
-
-    values.erase(values.begin() + index);
-
-    heapify();
+  /// @param element new element, moved into the heap
+  void insert(T &&element) {
+    values.push_back(std::move(element));
+    ascend(values.size() - 1);
   }
 
+  void remove(T &value) { remove_at(find_index(values, value)); }
+
   inline void remove(T &&value) { remove(value); }
 
+  /// @brief remove the value at the index, the last value takes its place and
+  /// moves up or down so it is O(log n)
+  /// @param index index of the value in the heap array
   void remove_at(int index) {
-    if (index < 0) {
+    if (index < 0 || index >= static_cast<int>(values.size())) {
       return;
     }
 
-    const size_t current_length = values.size();
+    const size_t last_index = values.size() - 1;
 
-    if (index == 0 && current_length == 1) {
-      values.clear();
+    if (static_cast<size_t>(index) == last_index) {
+      values.pop_back();
       return;
     }
 
-    values.erase(values.begin() + index);
-    heapify();
+    values[index] = std::move(values[last_index]);
+    values.pop_back();
+
+    if (index > 0 &&
+        compare_bigger(values[index], values[get_parent_index(index)])) {
+      ascend(index);
+    } else {
+      descend(index);
+    }
   }
 
   /// @brief get the top element, children count affects its performance
@@ -72,27 +75,45 @@ public:
   T top() {
     PXD_ASSERT(values.size() > 0);
 
-    T last_value = values[values.size() - 1];
-    values.erase(values.end() - 1);
+    T root_value = std::move(values[0]);
 
-    if (values.size() == 0) {
-      values.clear();
-      return last_value;
+    if (values.size() > 1) {
+      values[0] = std::move(values.back());
+      values.pop_back();
+      descend(0);
+    } else {
+      values.pop_back();
     }
 
-    T root_node = values[0];
-    values[0] = last_value;
-    descend(0);
-
-    return root_node;
+    return root_value;
   }
 
-  inline T peek() {
+  inline const T &peek() const {
     PXD_ASSERT(values.size() > 0);
 
     return values[0];
   }
 
+  /// @brief replace the top element with the new one, a single descend
+  /// instead of the descend of top() and the ascend of insert()
+  /// @param element new element
+  void replace_top(const T &element) {
+    PXD_ASSERT(values.size() > 0);
+
+    values[0] = element;
+    descend(0);
+  }
+
+  /// @brief replace the top element with the new one, a single descend
+  /// instead of the descend of top() and the ascend of insert()
+  /// @param element new element, moved into the heap
+  void replace_top(T &&element) {
+    PXD_ASSERT(values.size() > 0);
+
+    values[0] = std::move(element);
+    descend(0);
+  }
+
   void update(T &value) {
     int index = find_index(values, value);
 
@@ -125,97 +146,173 @@ public:
 
   inline int where(T &value) { return find_index(values, value); }
 
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Batch Functions
+
+  /// @brief replace the values with the range and build the heap bottom up,
+  /// O(n) instead of the O(n log n) of the inserts. Use std::move_iterator
+  /// to move the values
+  /// @param first start of the range
+  /// @param last end of the range
+  template <typename Iterator> void from_range(Iterator first, Iterator last) {
+    values.assign(first, last);
+    heapify();
+  }
+
+  /// @brief take the vector's values and build the heap bottom up
+  /// @param new_values values, the heap uses the vector's storage
+  void from_vector(std::vector<T> &&new_values) {
+    values = std::move(new_values);
+    heapify();
+  }
+
+  /// @brief insert all the values of the range. A batch which is bigger than
+  /// the heap rebuilds the heap bottom up, a smaller one is inserted one by
+  /// one
+  /// @param first start of the range
+  /// @param last end of the range
+  template <typename Iterator> void push_batch(Iterator first, Iterator last) {
+    const size_t old_size = values.size();
+
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                    typename std::iterator_traits<
+                                        Iterator>::iterator_category>) {
+      values.reserve(old_size + std::distance(first, last));
+    }
+
+    values.insert(values.end(), first, last);
+
+    const size_t batch_size = values.size() - old_size;
+
+    if (batch_size >= old_size) {
+      heapify();
+      return;
+    }
+
+    for (size_t i = old_size; i < values.size(); i++) {
+      ascend(i);
+    }
+  }
+
+  /// @brief remove the k top values
+  /// @param k wanted value count, all the values if the heap is smaller
+  /// @return the values in the priority order
+  auto pop_n(size_t k) -> std::vector<T> {
+    const size_t count = k < values.size() ? k : values.size();
+
+    std::vector<T> popped;
+    popped.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+      popped.push_back(top());
+    }
+
+    return popped;
+  }
+
+  /// @brief empty the heap
+  /// @return all the values in the priority order
+  auto pop_all_sorted() -> std::vector<T> {
+    // heap sort in place, every top goes to the end of the shrinking heap
+    std::vector<T> sorted = std::move(values);
+    values = std::vector<T>();
+
+    for (size_t heap_size = sorted.size(); heap_size > 1; heap_size--) {
+      std::swap(sorted[0], sorted[heap_size - 1]);
+      descend_in(sorted, heap_size - 1, 0);
+    }
+
+    // the lowest priority is at the front
+    std::reverse(sorted.begin(), sorted.end());
+
+    return sorted;
+  }
+
   inline void shrink() { values.shrink_to_fit(); }
   inline size_t get_size() const { return values.size(); }
   inline std::vector<T> get_values() { return values; }
 
 private:
+  /// @brief Floyd's bottom up build, descend every parent from the last one
   void heapify() {
-    int i = static_cast<int>((values.size() - 1) / D);
+    if (values.size() < 2) {
+      return;
+    }
 
-    for (; i >= 0; --i) {
+    for (size_t i = get_parent_index(values.size() - 1) + 1; i-- > 0;) {
       descend(i);
     }
   }
 
   void ascend(size_t index) {
     size_t current_index = index;
-    T current_value = values[index];
+    T current_value = std::move(values[index]);
 
     while (current_index > 0) {
       size_t parent_index = get_parent_index(current_index);
 
       if (compare_lower(values[parent_index], current_value)) {
-        values[current_index] = values[parent_index];
+        values[current_index] = std::move(values[parent_index]);
         current_index = parent_index;
       } else {
         break;
       }
     }
 
-    values[current_index] = current_value;
+    values[current_index] = std::move(current_value);
   }
 
-  void descend(size_t index = 0) {
-    size_t current_index = index;
-    const size_t first_leaf_index = get_first_leaf_index();
+  void descend(size_t index = 0) { descend_in(values, values.size(), index); }
 
-    T current_value = values[current_index];
-    T child_value;
+  /// @brief move the value down in the first heap_size values of the array,
+  /// the value is kept out of the array while the children move up
+  static void descend_in(std::vector<T> &array, size_t heap_size,
+                         size_t index) {
+    size_t current_index = index;
+    T current_value = std::move(array[current_index]);
 
-    while (current_index < first_leaf_index) {
-      size_t child_index = get_highest_priority_leaf(current_index);
-      child_value = values[child_index];
+    while (current_index * D + 1 < heap_size) {
+      size_t child_index =
+          get_highest_priority_leaf(array, heap_size, current_index);
 
-      if (compare_bigger(child_value, current_value)) {
-        values[current_index] = values[child_index];
+      if (compare_bigger(array[child_index], current_value)) {
+        array[current_index] = std::move(array[child_index]);
         current_index = child_index;
       } else {
         break;
       }
     }
 
-    values[current_index] = current_value;
+    array[current_index] = std::move(current_value);
   }
 
-  inline size_t get_highest_priority_leaf(size_t parent_index) {
-    const size_t child_index = D * parent_index;
-    T child_value = values[child_index];
-    size_t highest_child_index = child_index + 1;
-
-    for (int i = 2; i < D; i++) {
-      if (child_index + i >= values.size()) {
-        return highest_child_index;
-      }
-
-      if (compare_bigger(values[child_index + i], child_value)) {
-        child_value = values[child_index + i];
-        highest_child_index = child_index + i;
+  static size_t get_highest_priority_leaf(const std::vector<T> &array,
+                                          size_t heap_size,
+                                          size_t parent_index) {
+    const size_t first_child_index = D * parent_index + 1;
+    const size_t end_index = first_child_index + D < heap_size
+                                 ? first_child_index + D
+                                 : heap_size;
+    size_t highest_child_index = first_child_index;
+
+    for (size_t i = first_child_index + 1; i < end_index; i++) {
+      if (compare_bigger(array[i], array[highest_child_index])) {
+        highest_child_index = i;
       }
     }
 
-    if ((D * parent_index + 1) >= values.size()) {
-      return highest_child_index;
-    }
-
-    if ((compare_bigger(values[D * (parent_index + 1)], child_value))) {
-      child_value = values[D * (parent_index + 1)];
-      highest_child_index = D * (parent_index + 1);
-    }
-
     return highest_child_index;
   }
 
-  inline size_t get_parent_index(size_t index) noexcept {
+  static inline size_t get_parent_index(size_t index) noexcept {
     return (index - 1) / D;
   }
-  inline size_t get_first_leaf_index() noexcept {
-    return (values.size() - 2) / D + 1;
-  }
-  inline bool compare_lower(T &first_val, T &second_val) noexcept {
+  static inline bool compare_lower(const T &first_val,
+                                   const T &second_val) noexcept {
     return is_max_heap ? first_val < second_val : first_val > second_val;
   }
-  inline bool compare_bigger(T &first_val, T &second_val) noexcept {
+  static inline bool compare_bigger(const T &first_val,
+                                    const T &second_val) noexcept {
     return is_max_heap ? first_val > second_val : first_val < second_val;
   }
 
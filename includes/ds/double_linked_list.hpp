@@ -1,10 +1,12 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "node_allocator.hpp"
 
 namespace pxd {
 
-template <typename T> class DoubleLinkedList {
+template <typename T, template <typename> class NodeAllocator>
+class DoubleLinkedList {
 public:
   struct Node {
     T value;
@@ -24,26 +26,28 @@ public:
   DoubleLinkedList(T *array, int size, bool add_back = true) {
     from_array(array, size, add_back);
   }
-  DoubleLinkedList(const DoubleLinkedList<T> &other) {
+  DoubleLinkedList(const DoubleLinkedList &other) {
     from_double_linked_list(other);
   }
-  DoubleLinkedList &operator=(const DoubleLinkedList<T> &other) {
+  DoubleLinkedList &operator=(const DoubleLinkedList &other) {
     from_double_linked_list(other);
     return *this;
   }
-  constexpr DoubleLinkedList(DoubleLinkedList<T> &&other) {
+  constexpr DoubleLinkedList(DoubleLinkedList &&other)
+      : node_allocator(std::move(other.node_allocator)) {
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
 
     other.exec_move();
   }
-  constexpr DoubleLinkedList &operator=(DoubleLinkedList<T> &&other) {
+  constexpr DoubleLinkedList &operator=(DoubleLinkedList &&other) {
     release();
 
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
+    node_allocator = std::move(other.node_allocator);
 
     other.exec_move();
 
@@ -90,7 +94,7 @@ public:
     do {
       Node *prev_node = current_node;
       current_node = current_node->next;
-      delete prev_node;
+      node_allocator.deallocate(prev_node);
     } while (current_node != nullptr);
 
     head = nullptr;
@@ -102,34 +106,58 @@ public:
   /// @param value new value wants to be added
   /// @param add_back true add the value to the end, false add the value to the
   /// head
-  void add(T &value, bool add_back = true) noexcept {
-    Node *new_node = new Node();
+  /// @return the node that holds the value, stays valid until it is removed
+  auto add(T &value, bool add_back = true) noexcept -> Node * {
+    Node *new_node = node_allocator.allocate();
     new_node->value = value;
 
-    if (head == nullptr) {
-      head = new_node;
-      end = new_node;
-      length++;
-      return;
-    }
-
-    if (add_back) {
-      end->next = new_node;
-      new_node->prev = end;
-      end = new_node;
-    } else {
-      new_node->next = head;
-      head = new_node;
-    }
+    link_node(new_node, add_back);
 
-    length++;
+    return new_node;
   }
 
   /// @brief add new value to the double linked list
   /// @param value new value wants to be added
   /// @param add_back true add the value to the end, false add the value to the
   /// head
-  void add(T &&value, bool add_back = true) noexcept { add(value, add_back); }
+  /// @return the node that holds the value, stays valid until it is removed
+  auto add(T &&value, bool add_back = true) noexcept -> Node * {
+    return add(value, add_back);
+  }
+
+  /// @brief move the given node to the end without any allocation
+  /// @param node a node of this list which is returned from the add function
+  void move_to_end(Node *node) noexcept {
+    if (node == nullptr || node == end) {
+      return;
+    }
+
+    unlink_node(node);
+    link_node(node, true);
+  }
+
+  /// @brief move the given node to the head without any allocation
+  /// @param node a node of this list which is returned from the add function
+  void move_to_head(Node *node) noexcept {
+    if (node == nullptr || node == head) {
+      return;
+    }
+
+    unlink_node(node);
+    link_node(node, false);
+  }
+
+  /// @brief remove the given node without violating the double linked list
+  /// @param current_node the node want to be deleted
+  inline void remove_node(Node *current_node) noexcept {
+    if (current_node == nullptr) {
+      return;
+    }
+
+    unlink_node(current_node);
+
+    node_allocator.deallocate(current_node);
+  }
 
   /// @brief remove the node at the given index
   /// @param index the node's index
@@ -182,6 +210,11 @@ public:
   /// @param value the value wants to be removed
   void remove(T &&value) noexcept { remove(value); }
 
+  /// @brief prepare the node allocator for the given node count, only the
+  /// PoolNodeAllocator pre-allocates the nodes
+  /// @param node_count wanted node count
+  void reserve(int node_count) { node_allocator.reserve(node_count); }
+
   /// @brief reverse the double linked list's direction
   void reverse() noexcept {
     if (head == nullptr || length == 1) {
@@ -326,16 +359,40 @@ private:
     return current_node;
   }
 
-  /// @brief remove the given node without violating the double linked list
-  /// @param current_node the node want to be deleted
-  inline void remove_node(Node *current_node) noexcept {
-    if (current_node == nullptr) {
+  /// @brief link the detached node to the head or the end of the list
+  /// @param node the detached node
+  /// @param add_back true link to the end, false link to the head
+  inline void link_node(Node *node, bool add_back) noexcept {
+    node->next = nullptr;
+    node->prev = nullptr;
+
+    length++;
+
+    if (head == nullptr) {
+      head = node;
+      end = node;
       return;
     }
 
+    if (add_back) {
+      end->next = node;
+      node->prev = end;
+      end = node;
+    } else {
+      node->next = head;
+      head->prev = node;
+      head = node;
+    }
+  }
+
+  /// @brief detach the given node from the list without deleting it
+  /// @param current_node the node want to be detached
+  inline void unlink_node(Node *current_node) noexcept {
     if (current_node == head) {
       head = current_node->next;
-    } else if (current_node == end) {
+    }
+
+    if (current_node == end) {
       end = current_node->prev;
     }
 
@@ -350,19 +407,17 @@ private:
       forw_node->prev = prev_node;
     }
 
-    delete current_node;
+    current_node->next = nullptr;
+    current_node->prev = nullptr;
 
     length--;
-
-    if (head == nullptr) {
-      end = nullptr;
-    }
   }
 
-  inline void from_double_linked_list(const DoubleLinkedList<T> &other) {
+  inline void from_double_linked_list(const DoubleLinkedList &other) {
     release();
 
     const int other_length = other.get_length();
+    node_allocator.reserve(other_length);
 
     Node *current_node = other.get_head_node();
 
@@ -373,6 +428,7 @@ private:
   }
 
 private:
+  NodeAllocator<Node> node_allocator;
   Node *head = nullptr;
   Node *end = nullptr;
   int length = 0;
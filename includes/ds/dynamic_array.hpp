@@ -1,10 +1,25 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "../utility.hpp"
+#include <cstdint>
 #include <utility>
 
 namespace pxd {
 
+constexpr int PXD_DYNAMIC_ARRAY_INC_SIZE = 5;
+constexpr double PXD_DYNAMIC_ARRAY_GROWTH_FACTOR = 2.0;
+// the capacity is halved when only 1 / divisor of it is used, the gap between
+// the growth and the shrink points keeps the alternating add and remove_last
+// calls from reallocating every time
+constexpr int PXD_DYNAMIC_ARRAY_SHRINK_DIVISOR = 4;
+constexpr int PXD_DYNAMIC_ARRAY_MIN_SHRINK_CAPACITY = 16;
+
+enum class eGROWTH_POLICY : std::uint8_t {
+  GEOMETRIC, // multiply the capacity with the growth factor, amortized O(1)
+  FIXED,     // add the increment count to the capacity, O(n) for every growth
+};
+
 template <typename T> class Array;
 
 template <typename T> class DynamicArray {
@@ -13,77 +28,127 @@ public:
   // Constructors
 
   constexpr DynamicArray() noexcept = default;
-  constexpr DynamicArray(int size, int inc_size = 5)
-      : inc_size_count(inc_size) {
+  constexpr DynamicArray(int size, int inc_size = PXD_DYNAMIC_ARRAY_INC_SIZE,
+                         eGROWTH_POLICY policy = eGROWTH_POLICY::GEOMETRIC)
+      : inc_size_count(inc_size), growth_policy(policy) {
     resize(size, true);
   }
   constexpr DynamicArray(T *values, int size) { expand(values, size); }
   constexpr DynamicArray(Array<T> &values) { expand(values); }
   constexpr DynamicArray(const DynamicArray &other) {
-    expand(other.get_data(), other.get_array().get_length());
+    from_dynamic_array(other);
   }
   constexpr DynamicArray(DynamicArray &&other) noexcept {
-    array = std::move(other.get_array());
+    array = std::move(other.array);
     element_count = other.get_element_count();
     total_capacity = other.get_total_capacity();
     total_byte_size = other.get_total_size();
     inc_size_count = other.get_increment_count();
+    growth_policy = other.get_growth_policy();
+    growth_factor = other.get_growth_factor();
 
     other.exec_move();
   }
   constexpr DynamicArray &operator=(DynamicArray &&other) {
+    if (this == &other) {
+      return *this;
+    }
+
     release();
 
-    array = std::move(other.get_array());
+    array = std::move(other.array);
     element_count = other.get_element_count();
     total_capacity = other.get_total_capacity();
     total_byte_size = other.get_total_size();
     inc_size_count = other.get_increment_count();
+    growth_policy = other.get_growth_policy();
+    growth_factor = other.get_growth_factor();
 
     other.exec_move();
 
     return *this;
   }
   constexpr DynamicArray &operator=(const DynamicArray &other) {
-    expand(other.get_data(), other.get_array().get_length());
+    if (this == &other) {
+      return *this;
+    }
+
+    from_dynamic_array(other);
+
+    return *this;
   }
   inline ~DynamicArray() noexcept { release(); }
 
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
   // Operator Overloads
 
-  constexpr decltype(auto) operator[](int index) { return array[index]; }
+  /// @brief negative indices are relative to the last value, not to the
+  /// capacity
+  constexpr decltype(auto) operator[](int index) {
+    return array[index < 0 ? element_count + index : index];
+  }
 
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
   // DS Functionalities
 
   /// @brief append the given value to the back of the array
   /// @param value the given value
-  void add(T &value) {
-    if (total_capacity == 0) {
-      resize(inc_size_count);
-    }
+  void add(const T &value) { emplace_back(value); }
+  /// @brief append the given value to the back of the array
+  /// @param value the given value
+  void add(T &&value) { emplace_back(std::move(value)); }
 
+  /// @brief create a value at the back of the array from the arguments
+  /// @param args constructor arguments of the value
+  /// @return the created value
+  template <typename... Args> T &emplace_back(Args &&...args) {
     if (element_count == total_capacity) {
-      add_capacity();
+      // the arguments may refer to a value of the array, create the value
+      // before the values are moved to the new array
+      T value(std::forward<Args>(args)...);
+      grow(element_count + 1);
+      array[element_count] = std::move(value);
+    } else {
+      array[element_count] = T(std::forward<Args>(args)...);
     }
 
-    array[element_count] = value;
-
     element_count++;
+
+    return array[element_count - 1];
   }
-  /// @brief append the given value to the back of the array
-  /// @param value the given value
-  constexpr void add(T &&value) { add(value); }
 
-  /// @brief get index of the value
+  /// @brief make sure the given count of values can be stored without a
+  /// reallocation
+  /// @param capacity wanted capacity
+  void reserve(int capacity) {
+    if (capacity <= total_capacity) {
+      return;
+    }
+
+    resize(capacity);
+  }
+
+  /// @brief get index of the value, only the added values are searched
   /// @param value wanted value to be found
   /// @return index value if successful, if not INDEX_NONE
-  constexpr int where(T &value) noexcept { return array.where(value); }
-  /// @brief get index of the value
+  int where(const T &value) const noexcept {
+    return find<T>(get_data(), element_count, value);
+  }
+
+  /// @brief get count of the values which are equal to the given value
+  /// @param value wanted value to be counted
+  /// @return count of the equal values
+  int count(const T &value) const noexcept {
+    return pxd::count<T>(get_data(), element_count, value);
+  }
+
+  /// @brief mark the values which are equal to the given value
   /// @param value wanted value to be found
-  /// @return index value if successful, if not INDEX_NONE
-  constexpr int where(T &&value) noexcept { return array.where(value); }
+  /// @param bitmap output, get_bitmap_word_count(element_count) words
+  /// @return count of the equal values
+  int find_all(const T &value, std::uint64_t *bitmap) const noexcept {
+    return pxd::find_all<T>(get_data(), element_count, value, bitmap);
+  }
 
   /// @brief release the array
   inline void release() noexcept {
@@ -119,7 +184,8 @@ public:
     total_byte_size = element_count * sizeof(T);
   }
 
-  /// @brief remove and return the last value of the array
+  /// @brief remove and return the last value of the array. The capacity is
+  /// halved when only a quarter of it is used
   /// @return the last value
   T remove_last() {
     if (element_count == 0) {
@@ -127,9 +193,12 @@ public:
     }
 
     element_count--;
-    T last_node = array[element_count];
+    T last_node = std::move(array[element_count]);
 
-    shrink();
+    if (total_capacity >= PXD_DYNAMIC_ARRAY_MIN_SHRINK_CAPACITY &&
+        element_count <= total_capacity / PXD_DYNAMIC_ARRAY_SHRINK_DIVISOR) {
+      resize(total_capacity / 2);
+    }
 
     return last_node;
   }
@@ -138,22 +207,21 @@ public:
   /// @param given_array the array that contains values
   /// @param size total value count of the given array
   void expand(T *new_values, int size) {
-    array.expand(new_values, size);
+    if (element_count + size > total_capacity) {
+      grow(element_count + size);
+    }
+
+    for (int i = 0; i < size; i++) {
+      array[element_count + i] = new_values[i];
+    }
 
     element_count += size;
-    total_capacity += size;
-    total_byte_size = total_capacity * sizeof(T);
   }
 
   /// @brief expand the array with given array's values
   /// @param given_array the array that contains values
   void expand(Array<T> &new_values) {
-    int size = new_values.get_length();
-    array.expand(new_values);
-
-    element_count += size;
-    total_capacity += size;
-    total_byte_size = total_capacity * sizeof(T);
+    expand(new_values.get_ptr(), new_values.get_length());
   }
 
   // ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +240,10 @@ public:
     return (element_count * sizeof(T));
   }
   inline int get_increment_count() const noexcept { return inc_size_count; }
+  inline eGROWTH_POLICY get_growth_policy() const noexcept {
+    return growth_policy;
+  }
+  inline double get_growth_factor() const noexcept { return growth_factor; }
 
   /// @brief the function has to be executed in the move constructors. releasing
   /// class without deleting
@@ -180,7 +252,9 @@ public:
     element_count = 0;
     total_capacity = 0;
     total_byte_size = 0;
-    inc_size_count = 5;
+    inc_size_count = PXD_DYNAMIC_ARRAY_INC_SIZE;
+    growth_policy = eGROWTH_POLICY::GEOMETRIC;
+    growth_factor = PXD_DYNAMIC_ARRAY_GROWTH_FACTOR;
   }
 
   /// @brief set increment size of the capacity
@@ -193,6 +267,22 @@ public:
     inc_size_count = inc_size;
   }
 
+  /// @brief set how the capacity grows when the array is full
+  /// @param policy wanted growth policy
+  constexpr inline void set_growth_policy(eGROWTH_POLICY policy) noexcept {
+    growth_policy = policy;
+  }
+
+  /// @brief set the multiplier of the geometric growth
+  /// @param factor wanted factor, has to be greater than 1
+  constexpr inline void set_growth_factor(double factor) noexcept {
+    if (factor <= 1.0) {
+      return;
+    }
+
+    growth_factor = factor;
+  }
+
   /// @brief resize array with contained values
   /// @param new_size wanted new size
   void resize(int size, bool need_more = false) {
@@ -206,12 +296,32 @@ public:
   }
 
 private:
-  /// @brief resize to new increased size which is greater than the
-  /// element_count with inc_size_count difference
-  void add_capacity() {
+  /// @brief resize to a new capacity which is chosen by the growth policy and
+  /// is at least the wanted capacity
+  /// @param wanted_capacity minimum capacity after the growth
+  void grow(int wanted_capacity) {
     int new_size = total_capacity + inc_size_count;
 
-    resize(new_size);
+    if (growth_policy == eGROWTH_POLICY::GEOMETRIC) {
+      const int scaled_size = static_cast<int>(total_capacity * growth_factor);
+      new_size = scaled_size > new_size ? scaled_size : new_size;
+    }
+
+    resize(new_size > wanted_capacity ? new_size : wanted_capacity);
+  }
+
+  void from_dynamic_array(const DynamicArray &other) {
+    release();
+
+    inc_size_count = other.get_increment_count();
+    growth_policy = other.get_growth_policy();
+    growth_factor = other.get_growth_factor();
+
+    if (other.get_element_count() == 0) {
+      return;
+    }
+
+    expand(other.get_data(), other.get_element_count());
   }
 
 private:
@@ -219,6 +329,8 @@ private:
   int element_count = 0;
   int total_capacity = 0;
   std::size_t total_byte_size = 0;
-  int inc_size_count = 5;
+  int inc_size_count = PXD_DYNAMIC_ARRAY_INC_SIZE;
+  eGROWTH_POLICY growth_policy = eGROWTH_POLICY::GEOMETRIC;
+  double growth_factor = PXD_DYNAMIC_ARRAY_GROWTH_FACTOR;
 };
 } // namespace pxd
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+
+#include "../checks.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace pxd {
+
+constexpr int PXD_DYNAMIC_RING_BUFFER_MIN_CAPACITY = 16;
+
+/// @brief growable array backed ring buffer, both ends are amortized O(1).
+/// The capacity is always a power of two so wrapping is a mask. Provides the
+/// LinkedList functions which are used by the Queue and the Stack so it can be
+/// their storage
+/// @tparam T value type
+template <typename T> class DynamicRingBuffer {
+public:
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors
+
+  DynamicRingBuffer() = default;
+  DynamicRingBuffer(T *array, int size, bool is_reverse = false) {
+    from_array(array, size, is_reverse);
+  }
+  DynamicRingBuffer(const DynamicRingBuffer &other) { from_ring_buffer(other); }
+  auto operator=(const DynamicRingBuffer &other) -> DynamicRingBuffer & {
+    if (this == &other) {
+      return *this;
+    }
+
+    from_ring_buffer(other);
+
+    return *this;
+  }
+  DynamicRingBuffer(DynamicRingBuffer &&other) noexcept
+      : buffer(other.buffer), capacity(other.capacity), head(other.head),
+        length(other.length) {
+    other.exec_move();
+  }
+  auto operator=(DynamicRingBuffer &&other) noexcept -> DynamicRingBuffer & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+
+    buffer = other.buffer;
+    capacity = other.capacity;
+    head = other.head;
+    length = other.length;
+
+    other.exec_move();
+
+    return *this;
+  }
+  ~DynamicRingBuffer() noexcept { release(); }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Operator Overloads
+
+  auto operator[](int index) noexcept -> T & {
+    return buffer[get_buffer_index(get_calc_index(index))];
+  }
+
+  auto operator[](int index) const noexcept -> const T & {
+    return buffer[get_buffer_index(get_calc_index(index))];
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // DS Functionalities
+
+  /// @brief destroy all the values and free the buffer
+  void release() noexcept {
+    clear();
+
+    if (buffer == nullptr) {
+      return;
+    }
+
+    ::operator delete(buffer, std::align_val_t(alignof(T)));
+    exec_move();
+  }
+
+  /// @brief destroy all the values and keep the buffer
+  void clear() noexcept {
+    for (int i = 0; i < length; i++) {
+      std::destroy_at(buffer + get_buffer_index(i));
+    }
+
+    head = 0;
+    length = 0;
+  }
+
+  /// @brief make sure the given count of values can be stored without growing
+  /// @param wanted_capacity wanted value count
+  void reserve(int wanted_capacity) {
+    if (wanted_capacity <= capacity) {
+      return;
+    }
+
+    int new_capacity = PXD_DYNAMIC_RING_BUFFER_MIN_CAPACITY;
+
+    while (new_capacity < wanted_capacity) {
+      new_capacity *= 2;
+    }
+
+    reallocate(new_capacity);
+  }
+
+  /// @brief add a value to the ring buffer
+  /// @param value value to be added
+  /// @param add_back true add the value to the end, false add the value to the
+  /// head
+  void add(const T &value, bool add_back = true) {
+    add_back ? push_back(value) : push_front(value);
+  }
+
+  /// @brief add a value to the ring buffer
+  /// @param value value to be added
+  /// @param add_back true add the value to the end, false add the value to the
+  /// head
+  void add(T &&value, bool add_back = true) {
+    add_back ? push_back(std::move(value)) : push_front(std::move(value));
+  }
+
+  template <typename... Args> auto emplace_back(Args &&...args) -> T & {
+    if (length == capacity) {
+      // the arguments may refer to a value of the buffer, create it before
+      // the buffer is reallocated
+      T value(std::forward<Args>(args)...);
+      grow();
+      return emplace_back(std::move(value));
+    }
+
+    T *slot = buffer + get_buffer_index(length);
+    std::construct_at(slot, std::forward<Args>(args)...);
+    length++;
+
+    return *slot;
+  }
+
+  template <typename... Args> auto emplace_front(Args &&...args) -> T & {
+    if (length == capacity) {
+      T value(std::forward<Args>(args)...);
+      grow();
+      return emplace_front(std::move(value));
+    }
+
+    const int new_head = (head - 1) & (capacity - 1);
+    T *slot = buffer + new_head;
+    std::construct_at(slot, std::forward<Args>(args)...);
+    head = new_head;
+    length++;
+
+    return *slot;
+  }
+
+  void push_back(const T &value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+  void push_front(const T &value) { emplace_front(value); }
+  void push_front(T &&value) { emplace_front(std::move(value)); }
+
+  /// @brief remove and return the first value
+  /// @return the first value
+  auto pop_front() -> T {
+    PXD_ASSERT(length > 0);
+
+    T *slot = buffer + head;
+    T value = std::move(*slot);
+    std::destroy_at(slot);
+
+    head = (head + 1) & (capacity - 1);
+    length--;
+
+    return value;
+  }
+
+  /// @brief remove and return the last value
+  /// @return the last value
+  auto pop_back() -> T {
+    PXD_ASSERT(length > 0);
+
+    T *slot = buffer + get_buffer_index(length - 1);
+    T value = std::move(*slot);
+    std::destroy_at(slot);
+
+    length--;
+
+    return value;
+  }
+
+  auto front() noexcept -> T & { return (*this)[0]; }
+  auto back() noexcept -> T & { return (*this)[-1]; }
+
+  /// @brief remove a value from the ring buffer with an index, O(1) for the
+  /// first and the last values
+  /// @param index the index of the value
+  void remove_at(int index) {
+    if (length == 0) {
+      return;
+    }
+
+    const int calc_index = get_calc_index(index);
+
+    if (calc_index == 0) {
+      std::destroy_at(buffer + head);
+      head = (head + 1) & (capacity - 1);
+      length--;
+      return;
+    }
+
+    for (int i = calc_index; i < length - 1; i++) {
+      (*this)[i] = std::move((*this)[i + 1]);
+    }
+
+    std::destroy_at(buffer + get_buffer_index(length - 1));
+    length--;
+  }
+
+  /// @brief reverse the order of the values
+  void reverse() noexcept {
+    for (int i = 0, j = length - 1; i < j; i++, j--) {
+      std::swap((*this)[i], (*this)[j]);
+    }
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // From Functions
+
+  void from_array(T *array, int size, bool is_reverse = false) {
+    clear();
+    reserve(size);
+
+    for (int i = 0; i < size; i++) {
+      add(array[i], !is_reverse);
+    }
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // To Functions
+
+  void to_array(T *array) const {
+    for (int i = 0; i < length; i++) {
+      array[i] = (*this)[i];
+    }
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Inline Member Funcs
+
+  auto get_length() const noexcept -> int { return length; }
+  auto get_capacity() const noexcept -> int { return capacity; }
+  auto is_empty() const noexcept -> bool { return length == 0; }
+
+  /// @brief the function has to be executed in the move constructors. releasing
+  /// class without deleting
+  constexpr void exec_move() noexcept {
+    buffer = nullptr;
+    capacity = 0;
+    head = 0;
+    length = 0;
+  }
+
+private:
+  /// @brief calculate index for negative and positive indices
+  /// @param index the given index
+  /// @return the calculated valid index
+  auto get_calc_index(int index) const noexcept -> int {
+    PXD_ASSERT(index < length && length + index >= 0);
+
+    return index < 0 ? length + index : index;
+  }
+
+  auto get_buffer_index(int index) const noexcept -> int {
+    return (head + index) & (capacity - 1);
+  }
+
+  void grow() {
+    reallocate(capacity == 0 ? PXD_DYNAMIC_RING_BUFFER_MIN_CAPACITY
+                             : capacity * 2);
+  }
+
+  /// @brief move the values to a new buffer, the first value is moved to the
+  /// start of the new buffer
+  /// @param new_capacity power of two capacity
+  void reallocate(int new_capacity) {
+    T *new_buffer = static_cast<T *>(::operator new(
+        static_cast<std::size_t>(new_capacity) * sizeof(T),
+        std::align_val_t(alignof(T))));
+
+    for (int i = 0; i < length; i++) {
+      T *slot = buffer + get_buffer_index(i);
+      std::construct_at(new_buffer + i, std::move(*slot));
+      std::destroy_at(slot);
+    }
+
+    if (buffer != nullptr) {
+      ::operator delete(buffer, std::align_val_t(alignof(T)));
+    }
+
+    buffer = new_buffer;
+    capacity = new_capacity;
+    head = 0;
+  }
+
+  void from_ring_buffer(const DynamicRingBuffer &other) {
+    clear();
+    reserve(other.get_length());
+
+    for (int i = 0; i < other.get_length(); i++) {
+      emplace_back(other[i]);
+    }
+  }
+
+private:
+  T *buffer = nullptr;
+  int capacity = 0;
+  int head = 0;
+  int length = 0;
+};
+} // namespace pxd
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../checks.hpp"
+#include "../simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace pxd {
+
+constexpr int PXD_EYTZINGER_ALIGNMENT = 64;
+
+/// @brief read only search tree of the sorted values in the Eytzinger (BFS)
+/// layout. The node k has the children 2k and 2k + 1 in the same array, so
+/// there are no pointers, the top levels share the cache lines and the search
+/// is a branchless loop which prefetches the cache line of the descendants
+/// a few levels below
+/// @tparam T trivially copyable value type, compared with <
+template <typename T> class EytzingerTree {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "EytzingerTree values are copied with memcpy");
+
+  // the 16 (for 4 byte values) descendants of the node k which are 4 levels
+  // below are k * 16 ... k * 16 + 15, a single aligned cache line
+  static constexpr int prefetch_block =
+      sizeof(T) < PXD_EYTZINGER_ALIGNMENT ? PXD_EYTZINGER_ALIGNMENT / sizeof(T)
+                                          : 1;
+
+public:
+  EytzingerTree() = default;
+  /// @param sorted_values values in the ascending order
+  /// @param size value count
+  EytzingerTree(const T *sorted_values, int size) {
+    from_sorted(sorted_values, size);
+  }
+  EytzingerTree(const EytzingerTree<T> &other) { copy_from(other); }
+  auto operator=(const EytzingerTree<T> &other) -> EytzingerTree & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+    copy_from(other);
+
+    return *this;
+  }
+  EytzingerTree(EytzingerTree<T> &&other) noexcept
+      : values(other.values), size(other.size) {
+    other.exec_move();
+  }
+  auto operator=(EytzingerTree<T> &&other) noexcept -> EytzingerTree & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+
+    values = other.values;
+    size = other.size;
+    other.exec_move();
+
+    return *this;
+  }
+  ~EytzingerTree() noexcept { release(); }
+
+  void release() noexcept {
+    if (values != nullptr) {
+      ::operator delete(values, std::align_val_t(PXD_EYTZINGER_ALIGNMENT));
+    }
+
+    exec_move();
+  }
+
+  /// @brief replace the values, O(n)
+  /// @param sorted_values values in the ascending order
+  /// @param new_size value count
+  void from_sorted(const T *sorted_values, int new_size) {
+    release();
+
+    if (new_size <= 0) {
+      return;
+    }
+
+    allocate(new_size);
+    fill(sorted_values, 0, 1);
+  }
+
+  /// @brief the smallest value which is not smaller than the key
+  /// @return pointer to the value in the tree, nullptr if all the values are
+  /// smaller
+  auto lower_bound(const T &key) const noexcept -> const T * {
+    std::size_t k = 1;
+
+    while (k <= static_cast<std::size_t>(size)) {
+      PXD_PREFETCH(values + k * prefetch_block);
+      k = 2 * k + (values[k] < key);
+    }
+
+    return get_result(k);
+  }
+
+  /// @brief the smallest value which is bigger than the key
+  /// @return pointer to the value in the tree, nullptr if there is none
+  auto upper_bound(const T &key) const noexcept -> const T * {
+    std::size_t k = 1;
+
+    while (k <= static_cast<std::size_t>(size)) {
+      PXD_PREFETCH(values + k * prefetch_block);
+      k = 2 * k + !(key < values[k]);
+    }
+
+    return get_result(k);
+  }
+
+  auto contains(const T &key) const noexcept -> bool {
+    const T *value = lower_bound(key);
+
+    return value != nullptr && !(key < *value);
+  }
+
+  auto get_size() const noexcept -> int { return size; }
+  auto is_empty() const noexcept -> bool { return size == 0; }
+
+private:
+  void exec_move() noexcept {
+    values = nullptr;
+    size = 0;
+  }
+
+  void allocate(int new_size) {
+    // the index 0 is not used, the root is 1
+    values = static_cast<T *>(
+        ::operator new((static_cast<std::size_t>(new_size) + 1) * sizeof(T),
+                       std::align_val_t(PXD_EYTZINGER_ALIGNMENT)));
+    size = new_size;
+  }
+
+  void copy_from(const EytzingerTree<T> &other) {
+    if (other.size == 0) {
+      return;
+    }
+
+    allocate(other.size);
+    memcpy(values + 1, other.values + 1,
+           static_cast<std::size_t>(size) * sizeof(T));
+  }
+
+  /// @brief in order walk of the implicit tree takes the sorted values
+  /// @return the next sorted index
+  auto fill(const T *sorted_values, int index, std::size_t k) -> int {
+    if (k <= static_cast<std::size_t>(size)) {
+      index = fill(sorted_values, index, 2 * k);
+      values[k] = sorted_values[index++];
+      index = fill(sorted_values, index, 2 * k + 1);
+    }
+
+    return index;
+  }
+
+  /// @brief the bits of k are the turns of the search, 1 is right. The
+  /// answer is the node of the last left turn, so the trailing right turns and
+  /// that left turn are shifted out
+  auto get_result(std::size_t k) const noexcept -> const T * {
+    k >>= std::countr_one(k) + 1;
+
+    return k != 0 ? values + k : nullptr;
+  }
+
+private:
+  T *values = nullptr;
+  int size = 0;
+};
+} // namespace pxd
@@ -0,0 +1,261 @@
+#pragma once
+
+#include "../checks.hpp"
+
+#include "../absl/flat_hash_map.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace pxd {
+
+/// @brief d-ary heap of unique keys which keeps the position of every key in
+/// a map. The map is updated with every move of the ascend and the descend,
+/// so the priority updates and the removals by key are O(log n) instead of a
+/// linear search and a heapify
+/// @tparam Key key type, has to be hashable by absl::Hash
+/// @tparam Priority priority type, compared with < and >
+/// @tparam D children count of a node
+/// @tparam is_max_heap true the highest priority is the top
+template <typename Key, typename Priority, int D = 4, bool is_max_heap = true>
+class IndexedDHeap {
+  static_assert(D >= 2, "IndexedDHeap needs at least 2 children per node");
+
+public:
+  struct Entry {
+    Key key;
+    Priority priority;
+  };
+
+public:
+  IndexedDHeap() = default;
+  IndexedDHeap(int wanted_size) { reserve(wanted_size); }
+  IndexedDHeap(const IndexedDHeap &other) = default;
+  auto operator=(const IndexedDHeap &other) -> IndexedDHeap & = default;
+  IndexedDHeap(IndexedDHeap &&other) noexcept = default;
+  auto operator=(IndexedDHeap &&other) noexcept -> IndexedDHeap & = default;
+  ~IndexedDHeap() noexcept { release(); }
+
+  void release() noexcept {
+    entries.clear();
+    positions.clear();
+  }
+
+  void reserve(int wanted_size) {
+    entries.reserve(wanted_size);
+    positions.reserve(wanted_size);
+  }
+
+  auto operator[](int index) const noexcept -> const Entry & {
+    return entries[index];
+  }
+
+  /// @brief insert a new key, the priority of the key is updated if it is in
+  /// the heap already
+  /// @param key the key
+  /// @param priority priority of the key
+  void insert(const Key &key, Priority priority) {
+    auto [position, is_inserted] =
+        positions.try_emplace(key, static_cast<int>(entries.size()));
+
+    if (!is_inserted) {
+      update_at(position->second, std::move(priority));
+      return;
+    }
+
+    entries.push_back(Entry{key, std::move(priority)});
+    ascend(static_cast<int>(entries.size()) - 1);
+  }
+
+  /// @brief change the priority of the key, the key moves up for an increase
+  /// and down for a decrease of a max heap
+  /// @param key the key, nothing is done if it is not in the heap
+  /// @param priority new priority
+  /// @return true if the key is in the heap
+  auto update(const Key &key, Priority priority) -> bool {
+    auto position = positions.find(key);
+
+    if (position == positions.end()) {
+      return false;
+    }
+
+    update_at(position->second, std::move(priority));
+
+    return true;
+  }
+
+  /// @brief remove the key, the last entry takes its place and moves up or
+  /// down
+  /// @param key the key
+  /// @return true if the key was in the heap
+  auto remove(const Key &key) -> bool {
+    auto position = positions.find(key);
+
+    if (position == positions.end()) {
+      return false;
+    }
+
+    const int index = position->second;
+    positions.erase(position);
+
+    remove_entry_at(index);
+
+    return true;
+  }
+
+  /// @brief remove and return the top entry
+  /// @return the entry with the highest priority, the lowest for a min heap
+  auto top() -> Entry {
+    PXD_ASSERT(!entries.empty());
+
+    Entry top_entry = std::move(entries[0]);
+    positions.erase(top_entry.key);
+
+    remove_entry_at(0);
+
+    return top_entry;
+  }
+
+  auto peek() const -> const Entry & {
+    PXD_ASSERT(!entries.empty());
+
+    return entries[0];
+  }
+
+  auto contains(const Key &key) const -> bool {
+    return positions.find(key) != positions.end();
+  }
+
+  /// @brief get the priority of the key
+  /// @param key the key, has to be in the heap
+  auto get_priority(const Key &key) const -> const Priority & {
+    auto position = positions.find(key);
+    PXD_ASSERT(position != positions.end());
+
+    return entries[position->second].priority;
+  }
+
+  /// @brief the position of the key in the heap array, -1 if it is not in the
+  /// heap
+  auto where(const Key &key) const -> int {
+    auto position = positions.find(key);
+
+    return position == positions.end() ? -1 : position->second;
+  }
+
+  void shrink() { entries.shrink_to_fit(); }
+  auto get_size() const noexcept -> size_t { return entries.size(); }
+  auto is_empty() const noexcept -> bool { return entries.empty(); }
+
+private:
+  void update_at(int index, Priority priority) {
+    const bool is_higher = compare_bigger(priority, entries[index].priority);
+    entries[index].priority = std::move(priority);
+
+    if (is_higher) {
+      ascend(index);
+    } else {
+      descend(index);
+    }
+  }
+
+  /// @brief the key of the entry has to be removed from the map already
+  void remove_entry_at(int index) {
+    const int last_index = static_cast<int>(entries.size()) - 1;
+
+    if (index != last_index) {
+      entries[index] = std::move(entries[last_index]);
+      entries.pop_back();
+
+      // the last entry may belong above or below the removed one
+      const int parent_index = get_parent_index(index);
+
+      if (index > 0 && compare_bigger(entries[index].priority,
+                                      entries[parent_index].priority)) {
+        ascend(index);
+      } else {
+        descend(index);
+      }
+
+      return;
+    }
+
+    entries.pop_back();
+  }
+
+  // the moving entry is kept out of the array while the others are shifted
+  // into the hole, every shifted entry's position is updated once
+
+  void ascend(int index) {
+    Entry current = std::move(entries[index]);
+
+    while (index > 0) {
+      const int parent_index = get_parent_index(index);
+
+      if (!compare_bigger(current.priority, entries[parent_index].priority)) {
+        break;
+      }
+
+      move_entry(parent_index, index);
+      index = parent_index;
+    }
+
+    place_entry(std::move(current), index);
+  }
+
+  void descend(int index) {
+    const int size = static_cast<int>(entries.size());
+    Entry current = std::move(entries[index]);
+
+    while (true) {
+      const int first_child = index * D + 1;
+
+      if (first_child >= size) {
+        break;
+      }
+
+      const int last_child = first_child + D < size ? first_child + D : size;
+      int best_child = first_child;
+
+      for (int i = first_child + 1; i < last_child; i++) {
+        if (compare_bigger(entries[i].priority,
+                           entries[best_child].priority)) {
+          best_child = i;
+        }
+      }
+
+      if (!compare_bigger(entries[best_child].priority, current.priority)) {
+        break;
+      }
+
+      move_entry(best_child, index);
+      index = best_child;
+    }
+
+    place_entry(std::move(current), index);
+  }
+
+  void move_entry(int from, int to) {
+    entries[to] = std::move(entries[from]);
+    positions[entries[to].key] = to;
+  }
+
+  void place_entry(Entry &&entry, int index) {
+    entries[index] = std::move(entry);
+    positions[entries[index].key] = index;
+  }
+
+  static constexpr auto get_parent_index(int index) noexcept -> int {
+    return (index - 1) / D;
+  }
+  static constexpr auto compare_bigger(const Priority &first,
+                                       const Priority &second) noexcept
+      -> bool {
+    return is_max_heap ? first > second : first < second;
+  }
+
+private:
+  std::vector<Entry> entries;
+  absl::flat_hash_map<Key, int> positions;
+};
+} // namespace pxd
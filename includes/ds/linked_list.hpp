@@ -1,12 +1,14 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "node_allocator.hpp"
 
 #include <cstddef>
 
 namespace pxd {
 
-template <typename T> class LinkedList {
+template <typename T, template <typename> class NodeAllocator>
+class LinkedList {
 public:
   struct Node {
     T value;
@@ -25,25 +27,27 @@ public:
   LinkedList(T *node_list, int size, bool is_reverse = false) {
     from_array(node_list, size, is_reverse);
   }
-  constexpr LinkedList(const LinkedList<T> &other) { from_linked_list(other); }
-  constexpr LinkedList(LinkedList<T> &&other) noexcept {
+  constexpr LinkedList(const LinkedList &other) { from_linked_list(other); }
+  constexpr LinkedList(LinkedList &&other) noexcept
+      : node_allocator(std::move(other.node_allocator)) {
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
     other.exec_move();
   }
-  constexpr LinkedList &operator=(LinkedList<T> &&other) {
+  constexpr LinkedList &operator=(LinkedList &&other) {
     release();
 
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
+    node_allocator = std::move(other.node_allocator);
 
     other.exec_move();
 
     return *this;
   }
-  constexpr LinkedList &operator=(const LinkedList<T> &other) {
+  constexpr LinkedList &operator=(const LinkedList &other) {
     from_linked_list(other);
 
     return *this;
@@ -67,7 +71,7 @@ public:
 
   // actually; head, end and length will be same and inner nodes may be
   // different if the user tries hard enough but whatever
-  constexpr bool operator==(LinkedList<T> &other) noexcept {
+  constexpr bool operator==(LinkedList &other) noexcept {
     return head == other.get_head_node() && end == other.get_end_node() &&
                    length == other.get_length()
                ? true
@@ -76,7 +80,7 @@ public:
 
   // actually; head, end and length will be same and inner nodes may be
   // different if the user tries hard enough but whatever
-  constexpr bool operator!=(LinkedList<T> &other) noexcept {
+  constexpr bool operator!=(LinkedList &other) noexcept {
     return head != other.get_head_node() && end != other.get_end_node() &&
                    length != other.get_length()
                ? true
@@ -97,7 +101,7 @@ public:
     do {
       Node *prev_node = current_node;
       current_node = current_node->next;
-      delete prev_node;
+      node_allocator.deallocate(prev_node);
     } while (current_node != nullptr);
 
     head = nullptr;
@@ -150,26 +154,11 @@ public:
   /// @param new_value value to be added
   /// @param add_back true add the value to the end, false add the value to the
   /// head
-  inline void add(T &new_value, bool add_back = true) noexcept {
-    Node *new_node = new Node();
+  inline void add(const T &new_value, bool add_back = true) noexcept {
+    Node *new_node = node_allocator.allocate();
     new_node->value = new_value;
 
-    if (head == nullptr) {
-      head = new_node;
-      end = new_node;
-      length++;
-      return;
-    }
-
-    if (add_back) {
-      end->next = new_node;
-      end = new_node;
-    } else {
-      new_node->next = head;
-      head = new_node;
-    }
-
-    length++;
+    link_node(new_node, add_back);
   }
 
   /// @brief add a value to the linked list
@@ -177,7 +166,10 @@ public:
   /// @param add_back true add the value to the end, false add the value to the
   /// head
   inline void add(T &&new_value, bool add_back = true) {
-    add(new_value, add_back);
+    Node *new_node = node_allocator.allocate();
+    new_node->value = std::move(new_value);
+
+    link_node(new_node, add_back);
   }
 
   /// @brief remove a value from the linked list with an index
@@ -226,6 +218,11 @@ public:
   /// @param value the value wants to be removed
   void remove(T &&value) noexcept { remove(value); }
 
+  /// @brief prepare the node allocator for the given node count, only the
+  /// PoolNodeAllocator pre-allocates the nodes
+  /// @param node_count wanted node count
+  void reserve(int node_count) { node_allocator.reserve(node_count); }
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
   // From Functions
 
@@ -273,10 +270,16 @@ public:
   }
 
 private:
-  constexpr void from_linked_list(const LinkedList<T> &other) {
+  constexpr void from_linked_list(const LinkedList &other) {
     release();
 
-    Node *this_current_node = new Node();
+    if (other.get_length() == 0) {
+      return;
+    }
+
+    node_allocator.reserve(other.get_length());
+
+    Node *this_current_node = node_allocator.allocate();
     Node *other_current_node = other.get_head_node();
 
     this_current_node->value = other_current_node->value;
@@ -286,7 +289,7 @@ private:
     length = other.get_length();
 
     for (int i = 1; i < length; i++) {
-      Node *new_node = new Node();
+      Node *new_node = node_allocator.allocate();
       new_node->value = other_current_node->value;
 
       this_current_node->next = new_node;
@@ -298,6 +301,28 @@ private:
     end = this_current_node;
   }
 
+  /// @brief link a new node to the head or the end of the linked list
+  /// @param new_node node which is not in the list
+  /// @param add_back true link to the end, false link to the head
+  inline void link_node(Node *new_node, bool add_back) noexcept {
+    if (head == nullptr) {
+      head = new_node;
+      end = new_node;
+      length++;
+      return;
+    }
+
+    if (add_back) {
+      end->next = new_node;
+      end = new_node;
+    } else {
+      new_node->next = head;
+      head = new_node;
+    }
+
+    length++;
+  }
+
   /// @brief calculate index for negative and positive indices
   /// @param index the given index
   /// @return the calculated valid index
@@ -338,7 +363,7 @@ private:
       prev_node->next = current_node->next;
     }
 
-    delete current_node;
+    node_allocator.deallocate(current_node);
     current_node = nullptr;
 
     if (head == nullptr) {
@@ -349,6 +374,7 @@ private:
   }
 
 private:
+  NodeAllocator<Node> node_allocator;
   Node *head = nullptr;
   Node *end = nullptr;
   int length = 0;
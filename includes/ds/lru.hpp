@@ -11,6 +11,11 @@ namespace pxd {
 
 constexpr size_t PXD_LRU_CACHE_MAX_SIZE = 32;
 
+/// @brief least recently used cache. The map holds the recency list's nodes
+/// directly so hits, inserts and evictions are O(1) and a hit does not
+/// allocate
+/// @tparam Key key type, has to be hashable by absl::Hash
+/// @tparam Val value type
 template <typename Key, typename Val> class LRUCache {
 private:
   struct LRUNode {
@@ -23,53 +28,146 @@ private:
     auto operator!=(LRUNode &&other) { return key != other.key; }
   };
 
+  using ListNode = typename DoubleLinkedList<LRUNode>::Node;
+
 public:
-  LRUCache(size_t max_size = PXD_LRU_CACHE_MAX_SIZE) : max_size(max_size) {};
-  LRUCache(const LRUCache &other) = default;
-  auto operator=(const LRUCache &other) -> LRUCache & = default;
+  LRUCache(size_t max_size = PXD_LRU_CACHE_MAX_SIZE) : max_size(max_size) {
+    lru_map.reserve(max_size);
+  };
+  LRUCache(const LRUCache &other) { from_lru_cache(other); }
+  auto operator=(const LRUCache &other) -> LRUCache & {
+    if (this == &other) {
+      return *this;
+    }
+
+    from_lru_cache(other);
+
+    return *this;
+  }
   LRUCache(LRUCache &&other) = default;
   auto operator=(LRUCache &&other) -> LRUCache & = default;
   ~LRUCache() = default;
 
-  void insert(Key key, Val value) {
-    if (lru_map.contains(key)) {
-      lru_map.erase(key);
+  /// @brief insert or update the value of the key and mark it as the most
+  /// recently used
+  /// @param key the key
+  /// @param value the value
+  /// @return true if the least recently used entry is evicted
+  auto insert(Key key, Val value) -> bool {
+    if (max_size == 0) {
+      return false;
     }
 
-    LRUNode node;
-    node.key = key;
-    node.value = value;
+    auto iter = lru_map.find(key);
+
+    if (iter != lru_map.end()) {
+      ListNode *node = iter->second;
+      node->value.value = std::move(value);
+      lru_list.move_to_end(node);
+      return false;
+    }
 
-    lru_list.add(node);
-    lru_map.insert(
-        {key, std::make_unique<LRUNode>(lru_list.get_end_node()->value)});
+    // reuse the least recently used node instead of allocating a new one
+    if (lru_map.size() >= max_size) {
+      ListNode *head_node = lru_list.get_head_node();
+      lru_map.erase(head_node->value.key);
 
-    if (lru_map.size() <= max_size) {
-      return;
+      head_node->value.key = key;
+      head_node->value.value = std::move(value);
+      lru_list.move_to_end(head_node);
+
+      lru_map.insert({std::move(key), head_node});
+      return true;
     }
 
-    auto head_node_value = lru_list.get_head_node()->value;
+    LRUNode node;
+    node.key = key;
+    node.value = std::move(value);
 
-    lru_list.remove(head_node_value);
-    lru_map.erase(head_node_value.key);
+    lru_map.insert({std::move(key), lru_list.add(node)});
+
+    return false;
   }
 
-  auto get(Key key) -> Val {
-    if (!lru_map.contains(key)) {
+  auto get(const Key &key) -> Val {
+    auto iter = lru_map.find(key);
+
+    if (iter == lru_map.end()) {
       PXD_LOG_WARNING("::PXD_LRU_CACHE:: Key is not exists")
       return {};
     }
 
-    LRUNode node = *(lru_map[key]);
-    lru_list.remove(node);
-    lru_list.add(node);
+    ListNode *node = iter->second;
+    lru_list.move_to_end(node);
+
+    return node->value.value;
+  }
+
+  /// @brief get the value without logging the missing keys
+  /// @param key the key
+  /// @param value output of the found value
+  /// @return true if the key exists
+  auto try_get(const Key &key, Val &value) -> bool {
+    auto iter = lru_map.find(key);
+
+    if (iter == lru_map.end()) {
+      return false;
+    }
 
-    return node.value;
+    ListNode *node = iter->second;
+    lru_list.move_to_end(node);
+    value = node->value.value;
+
+    return true;
+  }
+
+  /// @brief remove the key from the cache
+  /// @param key the key
+  /// @return true if the key exists
+  auto erase(const Key &key) -> bool {
+    auto iter = lru_map.find(key);
+
+    if (iter == lru_map.end()) {
+      return false;
+    }
+
+    lru_list.remove_node(iter->second);
+    lru_map.erase(iter);
+
+    return true;
+  }
+
+  void release() {
+    lru_list.release();
+    lru_map.clear();
+  }
+
+  auto contains(const Key &key) const -> bool { return lru_map.contains(key); }
+
+  auto get_size() const noexcept -> size_t { return lru_map.size(); }
+  auto get_max_size() const noexcept -> size_t { return max_size; }
+
+private:
+  void from_lru_cache(const LRUCache &other) {
+    lru_list.release();
+    lru_map.clear();
+
+    max_size = other.get_max_size();
+    lru_map.reserve(max_size);
+
+    const ListNode *current_node = other.lru_list.get_head_node();
+
+    while (current_node != nullptr) {
+      LRUNode node = current_node->value;
+      lru_map.insert({node.key, lru_list.add(node)});
+
+      current_node = current_node->next;
+    }
   }
 
 private:
   size_t max_size;
   DoubleLinkedList<LRUNode> lru_list;
-  absl::flat_hash_map<Key, std::unique_ptr<LRUNode>> lru_map;
+  absl::flat_hash_map<Key, ListNode *> lru_map;
 };
-} // namespace pxd
\ No newline at end of file
+} // namespace pxd
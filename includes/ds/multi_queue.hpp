@@ -0,0 +1,220 @@
+#pragma once
+
+#include "../checks.hpp"
+#include "dheap.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace pxd {
+
+constexpr int PXD_MULTI_QUEUE_QUEUES_PER_THREAD = 2;
+constexpr int PXD_MULTI_QUEUE_LOCK_ATTEMPTS = 8;
+
+/// @brief concurrent priority queue made of several independently locked
+/// DHeaps. A push goes to a random heap, try_pop looks at the tops of two
+/// random heaps and pops the better one, so the threads rarely wait for the
+/// same lock. The popped value is close to the top but not always the top,
+/// pop is the strict version which looks at all the heaps
+/// @tparam T value type, compared with < and >
+/// @tparam D children count of a heap node
+/// @tparam is_max_heap true the highest value is the top
+template <typename T, int D = 4, bool is_max_heap = true> class MultiQueue {
+private:
+  // every heap is in its own cache line to not share the lock's line
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    DHeap<T, D, is_max_heap> heap;
+    // read without the lock to skip the empty heaps
+    std::atomic<size_t> size = 0;
+  };
+
+public:
+  /// @param queue_count heap count, two heaps per hardware thread if it is
+  /// not positive
+  explicit MultiQueue(int queue_count = 0) {
+    if (queue_count <= 0) {
+      const int thread_count =
+          static_cast<int>(std::thread::hardware_concurrency());
+      queue_count = PXD_MULTI_QUEUE_QUEUES_PER_THREAD *
+                    (thread_count > 0 ? thread_count : 1);
+    }
+
+    // two choices need two heaps
+    this->queue_count = queue_count > 1 ? queue_count : 2;
+    queues = std::make_unique<Queue[]>(this->queue_count);
+  }
+  MultiQueue(const MultiQueue &other) = delete;
+  auto operator=(const MultiQueue &other) -> MultiQueue & = delete;
+  MultiQueue(MultiQueue &&other) = delete;
+  auto operator=(MultiQueue &&other) -> MultiQueue & = delete;
+  ~MultiQueue() = default;
+
+  void push(const T &value) { push_value(value); }
+  void push(T &&value) { push_value(std::move(value)); }
+
+  /// @brief pop a value which is close to the top, the better top of two
+  /// random heaps
+  /// @param value output of the popped value
+  /// @return false if all the heaps are empty
+  auto try_pop(T &value) -> bool {
+    for (int i = 0; i < PXD_MULTI_QUEUE_LOCK_ATTEMPTS; i++) {
+      Queue &first = get_random_queue();
+      Queue &second = get_random_queue();
+
+      if (first.size.load(std::memory_order_relaxed) == 0 &&
+          second.size.load(std::memory_order_relaxed) == 0) {
+        continue;
+      }
+
+      std::unique_lock<std::mutex> first_lock(first.mutex, std::try_to_lock);
+
+      if (!first_lock.owns_lock()) {
+        continue;
+      }
+
+      std::unique_lock<std::mutex> second_lock;
+
+      if (&second != &first) {
+        second_lock = std::unique_lock<std::mutex>(second.mutex,
+                                                   std::try_to_lock);
+      }
+
+      Queue *best = first.heap.get_size() > 0 ? &first : nullptr;
+
+      if (second_lock.owns_lock() && second.heap.get_size() > 0 &&
+          (best == nullptr ||
+           compare_bigger(second.heap.peek(), best->heap.peek()))) {
+        best = &second;
+      }
+
+      if (best != nullptr) {
+        value = pop_locked(*best);
+        return true;
+      }
+    }
+
+    // the random heaps were empty or busy, sweep the all heaps before giving
+    // up
+    for (int i = 0; i < queue_count; i++) {
+      Queue &queue = queues[i];
+
+      if (queue.size.load(std::memory_order_relaxed) == 0) {
+        continue;
+      }
+
+      std::lock_guard<std::mutex> lock(queue.mutex);
+
+      if (queue.heap.get_size() > 0) {
+        value = pop_locked(queue);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /// @brief pop the top of the all heaps, every heap is locked so it is much
+  /// slower than try_pop
+  /// @param value output of the popped value
+  /// @return false if all the heaps are empty
+  auto pop(T &value) -> bool {
+    // always lock in the index order to not deadlock with the other pops
+    for (int i = 0; i < queue_count; i++) {
+      queues[i].mutex.lock();
+    }
+
+    Queue *best = nullptr;
+
+    for (int i = 0; i < queue_count; i++) {
+      Queue &queue = queues[i];
+
+      if (queue.heap.get_size() > 0 &&
+          (best == nullptr ||
+           compare_bigger(queue.heap.peek(), best->heap.peek()))) {
+        best = &queue;
+      }
+    }
+
+    if (best != nullptr) {
+      value = pop_locked(*best);
+    }
+
+    for (int i = queue_count - 1; i >= 0; i--) {
+      queues[i].mutex.unlock();
+    }
+
+    return best != nullptr;
+  }
+
+  /// @brief total value count, only exact when no thread pushes or pops
+  auto get_size() const noexcept -> size_t {
+    size_t size = 0;
+
+    for (int i = 0; i < queue_count; i++) {
+      size += queues[i].size.load(std::memory_order_relaxed);
+    }
+
+    return size;
+  }
+
+  auto is_empty() const noexcept -> bool { return get_size() == 0; }
+  auto get_queue_count() const noexcept -> int { return queue_count; }
+
+private:
+  template <typename Value> void push_value(Value &&value) {
+    // take the first free heap, wait only if all the tried ones are busy
+    for (int i = 0; i < PXD_MULTI_QUEUE_LOCK_ATTEMPTS; i++) {
+      Queue &queue = get_random_queue();
+      std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+
+      if (lock.owns_lock()) {
+        push_locked(queue, std::forward<Value>(value));
+        return;
+      }
+    }
+
+    Queue &queue = get_random_queue();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    push_locked(queue, std::forward<Value>(value));
+  }
+
+  template <typename Value>
+  static void push_locked(Queue &queue, Value &&value) {
+    queue.heap.insert(std::forward<Value>(value));
+    queue.size.store(queue.heap.get_size(), std::memory_order_relaxed);
+  }
+
+  static auto pop_locked(Queue &queue) -> T {
+    T value = queue.heap.top();
+    queue.size.store(queue.heap.get_size(), std::memory_order_relaxed);
+
+    return value;
+  }
+
+  auto get_random_queue() noexcept -> Queue & {
+    // xorshift, every thread has its own state
+    thread_local std::uint64_t state =
+        0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state);
+
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return queues[state % static_cast<std::uint64_t>(queue_count)];
+  }
+
+  static constexpr auto compare_bigger(const T &first,
+                                       const T &second) noexcept -> bool {
+    return is_max_heap ? first > second : first < second;
+  }
+
+private:
+  std::unique_ptr<Queue[]> queues;
+  int queue_count = 0;
+};
+} // namespace pxd
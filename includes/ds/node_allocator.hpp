@@ -0,0 +1,203 @@
+#pragma once
+
+#include "../checks.hpp"
+
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace pxd {
+
+constexpr int PXD_NODE_POOL_CHUNK_SIZE = 64;
+
+/// @brief allocate every node separately with new and delete
+/// @tparam Node node type of the container
+template <typename Node> class DefaultNodeAllocator {
+public:
+  // the nodes are on the global heap, any allocator can deallocate them
+  static constexpr bool owns_nodes = false;
+
+public:
+  auto allocate() -> Node * { return new Node(); }
+  void deallocate(Node *node) noexcept { delete node; }
+
+  void reserve(int /*node_count*/) noexcept {}
+  void release() noexcept {}
+  void release_all() noexcept {}
+  void adopt(DefaultNodeAllocator && /*other*/) noexcept {}
+};
+
+/// @brief allocate nodes from contiguous chunks and recycle the deallocated
+/// nodes with a free list. Chunks are only freed when the allocator is
+/// destroyed or released, so the nodes have to be deallocated before that
+/// @tparam Node node type of the container
+template <typename Node> class PoolNodeAllocator {
+public:
+  // the nodes are in the chunks of the allocator, they have to go back to it
+  static constexpr bool owns_nodes = true;
+
+private:
+  union Slot {
+    Slot *next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+public:
+  PoolNodeAllocator() = default;
+  // the nodes belong to the copied container, start with an empty pool
+  PoolNodeAllocator(const PoolNodeAllocator &other) {}
+  auto operator=(const PoolNodeAllocator &other) -> PoolNodeAllocator & {
+    return *this;
+  }
+  PoolNodeAllocator(PoolNodeAllocator &&other) noexcept
+      : chunks(std::move(other.chunks)), free_list(other.free_list),
+        free_count(other.free_count), total_capacity(other.total_capacity) {
+    other.exec_move();
+  }
+  auto operator=(PoolNodeAllocator &&other) noexcept -> PoolNodeAllocator & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+
+    chunks = std::move(other.chunks);
+    free_list = other.free_list;
+    free_count = other.free_count;
+    total_capacity = other.total_capacity;
+
+    other.exec_move();
+
+    return *this;
+  }
+  ~PoolNodeAllocator() noexcept { release(); }
+
+  auto allocate() -> Node * {
+    if (free_list == nullptr) {
+      // grow geometrically to keep the chunk count logarithmic
+      const int chunk_size = total_capacity > PXD_NODE_POOL_CHUNK_SIZE
+                                 ? total_capacity
+                                 : PXD_NODE_POOL_CHUNK_SIZE;
+      allocate_chunk(chunk_size);
+    }
+
+    Slot *slot = free_list;
+    free_list = slot->next;
+    free_count--;
+
+    return new (slot->storage) Node();
+  }
+
+  void deallocate(Node *node) noexcept {
+    if (node == nullptr) {
+      return;
+    }
+
+    node->~Node();
+
+    Slot *slot = reinterpret_cast<Slot *>(node);
+    slot->next = free_list;
+    free_list = slot;
+    free_count++;
+  }
+
+  /// @brief make sure the next node_count allocations are served without
+  /// allocating a new chunk
+  /// @param node_count wanted free node count
+  void reserve(int node_count) {
+    if (node_count <= free_count) {
+      return;
+    }
+
+    allocate_chunk(node_count - free_count);
+  }
+
+  /// @brief free all the chunks, every node has to be deallocated before
+  void release() noexcept {
+    PXD_ASSERT(free_count == total_capacity);
+
+    release_all();
+  }
+
+  /// @brief free all the chunks at once, the nodes which are still allocated
+  /// are dropped without their destructors. A container of the trivially
+  /// destructible nodes releases its nodes with it instead of a walk which
+  /// deallocates them one by one
+  void release_all() noexcept {
+    for (Slot *chunk : chunks) {
+      delete[] chunk;
+    }
+
+    exec_move();
+  }
+
+  /// @brief take over the chunks and the free nodes of the other allocator,
+  /// its allocated nodes belong to this one after that
+  /// @param other the allocator, it is empty after the call
+  void adopt(PoolNodeAllocator &&other) {
+    if (this == &other || other.chunks.empty()) {
+      return;
+    }
+
+    chunks.insert(chunks.end(), other.chunks.begin(), other.chunks.end());
+
+    if (other.free_list != nullptr) {
+      Slot *last_slot = other.free_list;
+
+      while (last_slot->next != nullptr) {
+        last_slot = last_slot->next;
+      }
+
+      last_slot->next = free_list;
+      free_list = other.free_list;
+    }
+
+    free_count += other.free_count;
+    total_capacity += other.total_capacity;
+
+    other.exec_move();
+  }
+
+  auto get_free_count() const noexcept -> int { return free_count; }
+  auto get_total_capacity() const noexcept -> int { return total_capacity; }
+
+private:
+  void allocate_chunk(int chunk_size) {
+    Slot *chunk = new Slot[chunk_size];
+    chunks.push_back(chunk);
+
+    // push in reverse so the nodes are served in address order
+    for (int i = chunk_size - 1; i >= 0; i--) {
+      chunk[i].next = free_list;
+      free_list = &chunk[i];
+    }
+
+    free_count += chunk_size;
+    total_capacity += chunk_size;
+  }
+
+  void exec_move() noexcept {
+    chunks.clear();
+    free_list = nullptr;
+    free_count = 0;
+    total_capacity = 0;
+  }
+
+private:
+  std::vector<Slot *> chunks;
+  Slot *free_list = nullptr;
+  int free_count = 0;
+  int total_capacity = 0;
+};
+
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class LinkedList;
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class DoubleLinkedList;
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class XORDoubleLinkedList;
+
+} // namespace pxd
@@ -2,6 +2,11 @@
 
 #include "dheap.hpp"
 
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace pxd {
 
 template <typename T, int D = 4, bool is_max_heap = true> class PriorityQueue {
@@ -11,13 +16,13 @@ private:
     int priority = is_max_heap ? std::numeric_limits<int>::min()
                                : std::numeric_limits<int>::max();
 
-    auto operator<(const Node &other) -> bool {
+    auto operator<(const Node &other) const -> bool {
       return priority < other.priority;
     }
-    auto operator>(const Node &other) -> bool {
+    auto operator>(const Node &other) const -> bool {
       return priority > other.priority;
     }
-    auto operator==(const Node &other) -> bool {
+    auto operator==(const Node &other) const -> bool {
       return value == other.value && priority == other.priority;
     }
   };
@@ -25,16 +30,13 @@ private:
 public:
   void release() noexcept { nodes.release(); }
 
-  void insert(T &element, int priority) {
-    Node new_node;
-    new_node.value = element;
-    new_node.priority = is_max_heap ? priority : -1 * priority;
-
-    nodes.insert(new_node);
+  // the DHeap orders the nodes for the min heaps, the priority is kept as is
+  void insert(const T &element, int priority) {
+    nodes.insert(Node{element, priority});
   }
 
-  constexpr void insert(T &&element, int priority) {
-    insert(element, priority);
+  void insert(T &&element, int priority) {
+    nodes.insert(Node{std::move(element), priority});
   }
 
   void remove(T &value) {
@@ -52,8 +54,7 @@ public:
   auto top() -> T {
     PXD_ASSERT(nodes.get_size() > 0);
 
-    Node last_element = nodes.top();
-    return last_element.value;
+    return std::move(nodes.top().value);
   }
 
   auto peek() -> T {
@@ -80,6 +81,39 @@ public:
     update_priority(value, new_priority);
   }
 
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Batch Functions
+
+  /// @brief replace the queue with the range of the (value, priority) pairs,
+  /// the heap is built bottom up in O(n)
+  /// @param first start of the range
+  /// @param last end of the range
+  template <typename Iterator> void from_range(Iterator first, Iterator last) {
+    nodes.from_vector(make_nodes(first, last));
+  }
+
+  /// @brief insert the range of the (value, priority) pairs
+  /// @param first start of the range
+  /// @param last end of the range
+  template <typename Iterator> void push_batch(Iterator first, Iterator last) {
+    std::vector<Node> new_nodes = make_nodes(first, last);
+    nodes.push_batch(std::make_move_iterator(new_nodes.begin()),
+                     std::make_move_iterator(new_nodes.end()));
+  }
+
+  /// @brief remove the k top values
+  /// @param k wanted value count, all the values if the queue is smaller
+  /// @return the values in the priority order
+  auto pop_n(size_t k) -> std::vector<T> {
+    return take_values(nodes.pop_n(k));
+  }
+
+  /// @brief empty the queue
+  /// @return all the values in the priority order
+  auto pop_all_sorted() -> std::vector<T> {
+    return take_values(nodes.pop_all_sorted());
+  }
+
   void to_array(T *array) {
     const int size = nodes.get_size();
 
@@ -92,6 +126,30 @@ public:
   constexpr auto get_size() -> size_t const { return nodes.get_size(); }
 
 private:
+  template <typename Iterator>
+  static auto make_nodes(Iterator first, Iterator last) -> std::vector<Node> {
+    std::vector<Node> new_nodes;
+
+    for (; first != last; ++first) {
+      auto &&pair = *first;
+      new_nodes.push_back(
+          Node{std::forward<decltype(pair)>(pair).first, pair.second});
+    }
+
+    return new_nodes;
+  }
+
+  static auto take_values(std::vector<Node> &&popped) -> std::vector<T> {
+    std::vector<T> popped_values;
+    popped_values.reserve(popped.size());
+
+    for (Node &node : popped) {
+      popped_values.push_back(std::move(node.value));
+    }
+
+    return popped_values;
+  }
+
   auto find_index(T &value) -> int {
     const size_t size = nodes.get_size();
 
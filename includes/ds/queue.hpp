@@ -1,36 +1,39 @@
 #pragma once
 
+#include "dynamic_ring_buffer.hpp"
 #include "linked_list.hpp"
 
 namespace pxd {
-template <typename T> class Queue {
+/// @brief first in first out adapter
+/// @tparam T value type
+/// @tparam Container storage of the values, LinkedList or DynamicRingBuffer
+template <typename T, typename Container = LinkedList<T>> class Queue {
 public:
   Queue() : queue() {};
   Queue(T *array, int size) : queue(array, size) {};
-  Queue(const Queue<T> &other) : queue(other.get_queue()) {}
-  Queue(Queue<T> &&other) noexcept { queue = std::move(other.get_queue()); }
-  auto operator=(Queue<T> &&other) noexcept -> Queue & {
-    queue = std::move(other.get_queue());
+  Queue(const Queue &other) : queue(other.get_queue_ref()) {}
+  Queue(Queue &&other) noexcept : queue(other.take_queue()) {}
+  auto operator=(Queue &&other) noexcept -> Queue & {
+    queue = other.take_queue();
     return *this;
   }
-  auto operator=(const Queue<T> &other) -> Queue & {
-    if (other.get_queue().get_head_node() == queue.get_head_node()) {
+  auto operator=(const Queue &other) -> Queue & {
+    if (this == &other) {
       return *this;
     }
 
-    LinkedList<T> q(other.get_queue);
-    queue = q;
-    return q;
+    queue = other.get_queue_ref();
+    return *this;
   }
   ~Queue() { queue.release(); }
 
   void push(const T &value) { queue.add(value); }
-  void push(T &&value) { queue.add(value); }
+  void push(T &&value) { queue.add(std::move(value)); }
 
   auto pop() -> T {
     PXD_ASSERT(!is_empty());
 
-    T top_value = queue[0];
+    T top_value = std::move(queue[0]);
     queue.remove_at(0);
 
     return top_value;
@@ -42,17 +45,28 @@ public:
     return queue[0];
   }
 
-  void to_array(int *array) { queue.to_array(array); }
+  void to_array(T *array) { queue.to_array(array); }
 
   void release() { queue.release(); }
 
   void reverse() { queue.reverse(); }
 
   auto is_empty() const -> bool { return queue.is_empty(); }
-  auto get_queue() const -> LinkedList<T> { return queue; }
+  auto get_queue() const -> Container { return queue; }
   auto get_length() const -> int { return queue.get_length(); }
 
+  /// @brief inspect the storage without copying it
+  /// @return the storage of the queue
+  auto get_queue_ref() const noexcept -> const Container & { return queue; }
+
+  /// @brief move the storage out of the queue, the queue is empty afterwards
+  /// @return the storage of the queue
+  auto take_queue() noexcept -> Container { return std::move(queue); }
+
 private:
-  LinkedList<T> queue;
+  Container queue;
 };
-} // namespace pxd
\ No newline at end of file
+
+/// @brief Queue which stores the values in a contiguous growable ring buffer
+template <typename T> using RingQueue = Queue<T, DynamicRingBuffer<T>>;
+} // namespace pxd
@@ -5,31 +5,79 @@
 
 #include "../random_gen.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace pxd {
 /// @brief Randomized treap to use as (most possibly) balanced BST
 /// @tparam T value type
-template <typename T> class RandomizedTreap {
+/// @tparam NodeAllocator allocator of the nodes, see Treap
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class RandomizedTreap {
 public:
   RandomizedTreap() = default;
-  RandomizedTreap(const RandomizedTreap<T> &other) = default;
-  auto
-  operator=(const RandomizedTreap<T> &other) -> RandomizedTreap & = default;
+  RandomizedTreap(const RandomizedTreap &other) = default;
+  auto operator=(const RandomizedTreap &other) -> RandomizedTreap & = default;
   RandomizedTreap(RandomizedTreap &&other) = default;
   auto operator=(RandomizedTreap &&other) -> RandomizedTreap & = default;
   ~RandomizedTreap() = default;
 
-  void insert(const T &key) {
-    treap.insert(key, pxd::random::random_value<double>(0.0, 1.0));
+  /// @brief build from the sorted keys in O(n), the old keys are removed
+  /// @param keys keys in the strictly ascending order
+  /// @param size key count
+  void from_sorted(const T *keys, int size) {
+    std::vector<double> priorities(size);
+
+    for (double &priority : priorities) {
+      priority = get_random_priority();
+    }
+
+    treap.from_sorted(keys, priorities.data(), size);
+  }
+
+  void release() noexcept { treap.release(); }
+  void reserve(int node_count) { treap.reserve(node_count); }
+
+  void insert(const T &key) { treap.insert(key, get_random_priority()); }
+
+  auto contains(const T &key) const -> bool { return treap.contains(key); }
+
+  auto remove(const T &key) -> bool { return treap.remove(key); }
+
+  auto min() const -> const T & { return treap.min(); }
+  auto max() const -> const T & { return treap.max(); }
+
+  /// @brief move the keys >= key to the returned treap, O(log n)
+  auto split(const T &key) -> RandomizedTreap {
+    return RandomizedTreap(treap.split(key));
+  }
+
+  /// @brief append the keys of the other treap, they all have to be bigger
+  /// than the keys of this treap. O(log n)
+  void join(RandomizedTreap &&other) { treap.join(std::move(other.treap)); }
+
+  auto kth(int k) const -> const T & { return treap.kth(k); }
+  auto rank(const T &key) const -> int { return treap.rank(key); }
+  auto range_count(const T &low, const T &high) const -> int {
+    return treap.range_count(low, high);
+  }
+  auto range_query(const T &low, const T &high) const -> std::vector<T> {
+    return treap.range_query(low, high);
   }
 
-  void constains(const T &key) { return treap.contains(key); }
+  auto get_size() const noexcept -> int { return treap.get_size(); }
+  auto is_empty() const noexcept -> bool { return treap.is_empty(); }
 
-  void remove(const T &key) { return treap.remove(key); }
+private:
+  explicit RandomizedTreap(Treap<T, NodeAllocator> &&_treap)
+      : treap(std::move(_treap)) {}
 
-  auto min() -> T { return treap.min(); }
-  auto max() -> T { return treap.max(); }
+  static auto get_random_priority() -> double {
+    return pxd::random::random_value<double>(0.0, 1.0);
+  }
 
 private:
-  Treap<T> treap;
+  Treap<T, NodeAllocator> treap;
 };
-} // namespace pxd
\ No newline at end of file
+} // namespace pxd
@@ -1,8 +1,16 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
 
 namespace pxd {
+
+// the indices which are written by different threads are kept in different
+// cache lines, otherwise every write invalidates the other thread's line
+constexpr size_t PXD_RING_BUFFER_CACHE_LINE_SIZE = 64;
+
 template <typename T, size_t N> class RingBuffer {
 public:
   RingBuffer() = default;
@@ -40,4 +48,269 @@ private:
   size_t write_index = 0;
   size_t read_index = 0;
 };
-} // namespace pxd
\ No newline at end of file
+
+/// @brief bounded lock-free single producer single consumer ring buffer. Only
+/// one thread may push and only one thread may pop at the same time
+/// @tparam T value type, has to be default constructible and move assignable
+/// @tparam N capacity, has to be a power of two
+template <typename T, size_t N> class SPSCRingBuffer {
+  static_assert(N > 0 && (N & (N - 1)) == 0,
+                "SPSCRingBuffer capacity has to be a power of two");
+
+public:
+  SPSCRingBuffer() = default;
+  SPSCRingBuffer(const SPSCRingBuffer &other) = delete;
+  auto operator=(const SPSCRingBuffer &other) -> SPSCRingBuffer & = delete;
+  SPSCRingBuffer(SPSCRingBuffer &&other) = delete;
+  auto operator=(SPSCRingBuffer &&other) -> SPSCRingBuffer & = delete;
+  ~SPSCRingBuffer() = default;
+
+  /// @brief push a value, only called by the producer
+  /// @param value value to be pushed
+  /// @return false if the ring buffer is full
+  auto try_push(const T &value) -> bool { return emplace(value); }
+  auto try_push(T &&value) -> bool { return emplace(std::move(value)); }
+
+  /// @brief pop a value, only called by the consumer
+  /// @param value output of the popped value
+  /// @return false if the ring buffer is empty
+  auto try_pop(T &value) -> bool {
+    const size_t read = consumer.index.load(std::memory_order_relaxed);
+
+    if (read == consumer.cached_index) {
+      consumer.cached_index = producer.index.load(std::memory_order_acquire);
+
+      if (read == consumer.cached_index) {
+        return false;
+      }
+    }
+
+    value = std::move(buffer[read & mask]);
+    consumer.index.store(read + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /// @brief push the values as much as the free space, the values are
+  /// published with a single store
+  /// @param values values to be pushed
+  /// @param count value count
+  /// @return pushed value count
+  auto push_n(const T *values, size_t count) -> size_t {
+    const size_t write = producer.index.load(std::memory_order_relaxed);
+    size_t free_count = N - (write - producer.cached_index);
+
+    if (free_count < count) {
+      producer.cached_index = consumer.index.load(std::memory_order_acquire);
+      free_count = N - (write - producer.cached_index);
+    }
+
+    const size_t push_count = count < free_count ? count : free_count;
+
+    for (size_t i = 0; i < push_count; i++) {
+      buffer[(write + i) & mask] = values[i];
+    }
+
+    producer.index.store(write + push_count, std::memory_order_release);
+
+    return push_count;
+  }
+
+  /// @brief pop the values as much as the stored values, the slots are
+  /// released with a single store
+  /// @param values output of the popped values
+  /// @param count wanted value count
+  /// @return popped value count
+  auto pop_n(T *values, size_t count) -> size_t {
+    const size_t read = consumer.index.load(std::memory_order_relaxed);
+    size_t stored_count = consumer.cached_index - read;
+
+    if (stored_count < count) {
+      consumer.cached_index = producer.index.load(std::memory_order_acquire);
+      stored_count = consumer.cached_index - read;
+    }
+
+    const size_t pop_count = count < stored_count ? count : stored_count;
+
+    for (size_t i = 0; i < pop_count; i++) {
+      values[i] = std::move(buffer[(read + i) & mask]);
+    }
+
+    consumer.index.store(read + pop_count, std::memory_order_release);
+
+    return pop_count;
+  }
+
+  /// @brief the size is only a snapshot when the other thread is working
+  auto get_size() const noexcept -> size_t {
+    return producer.index.load(std::memory_order_acquire) -
+           consumer.index.load(std::memory_order_acquire);
+  }
+  auto is_empty() const noexcept -> bool { return get_size() == 0; }
+  static constexpr auto get_capacity() noexcept -> size_t { return N; }
+
+private:
+  template <typename U> auto emplace(U &&value) -> bool {
+    const size_t write = producer.index.load(std::memory_order_relaxed);
+
+    // the consumer's index is only loaded when the buffer looks full
+    if (write - producer.cached_index == N) {
+      producer.cached_index = consumer.index.load(std::memory_order_acquire);
+
+      if (write - producer.cached_index == N) {
+        return false;
+      }
+    }
+
+    buffer[write & mask] = std::forward<U>(value);
+    producer.index.store(write + 1, std::memory_order_release);
+
+    return true;
+  }
+
+private:
+  // index is owned by the side, cached_index is the side's last seen value of
+  // the other side's index
+  struct alignas(PXD_RING_BUFFER_CACHE_LINE_SIZE) Side {
+    std::atomic<size_t> index = 0;
+    size_t cached_index = 0;
+  };
+
+  static constexpr size_t mask = N - 1;
+
+  Side producer;
+  Side consumer;
+  std::array<T, N> buffer{};
+};
+
+/// @brief bounded lock-free multi producer multi consumer ring buffer. Every
+/// slot has a sequence number which tells the slot is ready to be written or
+/// read in the current lap, so the threads only compete on the index
+/// @tparam T value type, has to be default constructible and move assignable
+/// @tparam N capacity, has to be a power of two
+template <typename T, size_t N> class MPMCRingBuffer {
+  static_assert(N > 0 && (N & (N - 1)) == 0,
+                "MPMCRingBuffer capacity has to be a power of two");
+
+public:
+  MPMCRingBuffer() {
+    for (size_t i = 0; i < N; i++) {
+      buffer[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  MPMCRingBuffer(const MPMCRingBuffer &other) = delete;
+  auto operator=(const MPMCRingBuffer &other) -> MPMCRingBuffer & = delete;
+  MPMCRingBuffer(MPMCRingBuffer &&other) = delete;
+  auto operator=(MPMCRingBuffer &&other) -> MPMCRingBuffer & = delete;
+  ~MPMCRingBuffer() = default;
+
+  /// @brief push a value
+  /// @param value value to be pushed
+  /// @return false if the ring buffer is full
+  auto try_push(const T &value) -> bool { return emplace(value); }
+  auto try_push(T &&value) -> bool { return emplace(std::move(value)); }
+
+  /// @brief pop a value
+  /// @param value output of the popped value
+  /// @return false if the ring buffer is empty
+  auto try_pop(T &value) -> bool {
+    size_t read = read_index.load(std::memory_order_relaxed);
+
+    while (true) {
+      Slot &slot = buffer[read & mask];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                        static_cast<std::ptrdiff_t>(read + 1);
+
+      if (diff == 0) {
+        if (read_index.compare_exchange_weak(read, read + 1,
+                                             std::memory_order_relaxed)) {
+          value = std::move(slot.value);
+          // the slot is ready for the write of the next lap
+          slot.sequence.store(read + N, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        read = read_index.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// @brief push the values until the ring buffer is full
+  /// @param values values to be pushed
+  /// @param count value count
+  /// @return pushed value count, the values are pushed in order
+  auto push_n(const T *values, size_t count) -> size_t {
+    size_t push_count = 0;
+
+    while (push_count < count && try_push(values[push_count])) {
+      push_count++;
+    }
+
+    return push_count;
+  }
+
+  /// @brief pop the values until the ring buffer is empty
+  /// @param values output of the popped values
+  /// @param count wanted value count
+  /// @return popped value count
+  auto pop_n(T *values, size_t count) -> size_t {
+    size_t pop_count = 0;
+
+    while (pop_count < count && try_pop(values[pop_count])) {
+      pop_count++;
+    }
+
+    return pop_count;
+  }
+
+  /// @brief the size is only a snapshot when the other threads are working
+  auto get_size() const noexcept -> size_t {
+    const size_t write = write_index.load(std::memory_order_acquire);
+    const size_t read = read_index.load(std::memory_order_acquire);
+
+    return write > read ? write - read : 0;
+  }
+  auto is_empty() const noexcept -> bool { return get_size() == 0; }
+  static constexpr auto get_capacity() noexcept -> size_t { return N; }
+
+private:
+  template <typename U> auto emplace(U &&value) -> bool {
+    size_t write = write_index.load(std::memory_order_relaxed);
+
+    while (true) {
+      Slot &slot = buffer[write & mask];
+      const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                        static_cast<std::ptrdiff_t>(write);
+
+      if (diff == 0) {
+        if (write_index.compare_exchange_weak(write, write + 1,
+                                              std::memory_order_relaxed)) {
+          slot.value = std::forward<U>(value);
+          slot.sequence.store(write + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        write = write_index.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static constexpr size_t mask = N - 1;
+
+  alignas(PXD_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_t> write_index = 0;
+  alignas(PXD_RING_BUFFER_CACHE_LINE_SIZE) std::atomic<size_t> read_index = 0;
+  alignas(PXD_RING_BUFFER_CACHE_LINE_SIZE) std::array<Slot, N> buffer{};
+};
+} // namespace pxd
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "lru.hpp"
+
+#include "../absl/hash.hpp"
+
+#include <array>
+#include <limits>
+#include <mutex>
+
+namespace pxd {
+
+constexpr size_t PXD_SHARDED_LRU_CACHE_SHARD_COUNT = 16;
+
+struct LRUShardStats {
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+  size_t size = 0;
+};
+
+/// @brief thread safe LRUCache which partitions the keys into independently
+/// locked shards, threads only wait for each other on the same shard
+/// @tparam Key key type, has to be hashable by absl::Hash
+/// @tparam Val value type
+/// @tparam ShardCount total shard count
+template <typename Key, typename Val,
+          size_t ShardCount = PXD_SHARDED_LRU_CACHE_SHARD_COUNT>
+class ShardedLRUCache {
+  static_assert(ShardCount > 0, "ShardedLRUCache needs at least one shard");
+
+private:
+  // every shard is in its own cache line to not share the lock's line
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    LRUCache<Key, Val> cache;
+    LRUShardStats stats;
+  };
+
+public:
+  /// @param max_shard_size capacity of each shard
+  ShardedLRUCache(size_t max_shard_size = PXD_LRU_CACHE_MAX_SIZE) {
+    for (auto &shard : shards) {
+      shard.cache = LRUCache<Key, Val>(max_shard_size);
+    }
+  }
+  ShardedLRUCache(const ShardedLRUCache &other) = delete;
+  auto operator=(const ShardedLRUCache &other) -> ShardedLRUCache & = delete;
+  ShardedLRUCache(ShardedLRUCache &&other) = delete;
+  auto operator=(ShardedLRUCache &&other) -> ShardedLRUCache & = delete;
+  ~ShardedLRUCache() = default;
+
+  void insert(const Key &key, Val value) {
+    Shard &shard = get_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    if (shard.cache.insert(key, std::move(value))) {
+      shard.stats.evictions++;
+    }
+  }
+
+  auto get(const Key &key) -> Val {
+    Val value{};
+    try_get(key, value);
+
+    return value;
+  }
+
+  /// @brief get the value of the key
+  /// @param key the key
+  /// @param value output of the found value
+  /// @return true if the key exists
+  auto try_get(const Key &key, Val &value) -> bool {
+    Shard &shard = get_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    if (shard.cache.try_get(key, value)) {
+      shard.stats.hits++;
+      return true;
+    }
+
+    shard.stats.misses++;
+    return false;
+  }
+
+  auto erase(const Key &key) -> bool {
+    Shard &shard = get_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    return shard.cache.erase(key);
+  }
+
+  auto contains(const Key &key) -> bool {
+    Shard &shard = get_shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    return shard.cache.contains(key);
+  }
+
+  void release() {
+    for (auto &shard : shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.cache.release();
+      shard.stats = {};
+    }
+  }
+
+  /// @brief get the counters of the shard
+  /// @param shard_index index of the shard, lower than the ShardCount
+  /// @return copy of the shard's counters
+  auto get_shard_stats(size_t shard_index) -> LRUShardStats {
+    PXD_ASSERT(shard_index < ShardCount);
+
+    Shard &shard = shards[shard_index];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    LRUShardStats stats = shard.stats;
+    stats.size = shard.cache.get_size();
+
+    return stats;
+  }
+
+  /// @brief get the sum of the all shards' counters
+  /// @return total counters
+  auto get_stats() -> LRUShardStats {
+    LRUShardStats total;
+
+    for (size_t i = 0; i < ShardCount; i++) {
+      LRUShardStats stats = get_shard_stats(i);
+
+      total.hits += stats.hits;
+      total.misses += stats.misses;
+      total.evictions += stats.evictions;
+      total.size += stats.size;
+    }
+
+    return total;
+  }
+
+  auto get_size() -> size_t { return get_stats().size; }
+
+  /// @brief get the shard index of the key
+  /// @param key the key
+  /// @return index of the shard which holds the key
+  static auto get_shard_index(const Key &key) -> size_t {
+    // the shard's flat_hash_map uses the low bits of the same hash, so take the
+    // high bits to not reduce its entropy
+    constexpr int shift = std::numeric_limits<size_t>::digits / 2;
+    const size_t hash_value = absl::Hash<Key>{}(key);
+
+    return (hash_value >> shift) % ShardCount;
+  }
+
+  static constexpr auto get_shard_count() -> size_t { return ShardCount; }
+
+private:
+  auto get_shard(const Key &key) -> Shard & {
+    return shards[get_shard_index(key)];
+  }
+
+private:
+  std::array<Shard, ShardCount> shards;
+};
+} // namespace pxd
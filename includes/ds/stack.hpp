@@ -1,36 +1,39 @@
 #pragma once
 
+#include "dynamic_ring_buffer.hpp"
 #include "linked_list.hpp"
 
 namespace pxd {
-template <typename T> class Stack {
+/// @brief last in first out adapter
+/// @tparam T value type
+/// @tparam Container storage of the values, LinkedList or DynamicRingBuffer
+template <typename T, typename Container = LinkedList<T>> class Stack {
 public:
   Stack() : stack() {};
   Stack(T *array, int size) : stack(array, size, true) {};
-  Stack(const Stack<T> &other) : stack(other.get_stack()) {};
-  Stack(Stack<T> &&other) noexcept { stack = std::move(other.get_stack()); };
-  auto operator=(Stack<T> &&other) noexcept -> Stack & {
-    stack = std::move(other.get_stack());
+  Stack(const Stack &other) : stack(other.get_stack_ref()) {};
+  Stack(Stack &&other) noexcept : stack(other.take_stack()) {};
+  auto operator=(Stack &&other) noexcept -> Stack & {
+    stack = other.take_stack();
     return *this;
   }
-  auto operator=(const Stack<T> &other) -> Stack & {
-    if (other.get_stack().get_head_node() == stack.get_head_node()) {
+  auto operator=(const Stack &other) -> Stack & {
+    if (this == &other) {
       return *this;
     }
 
-    LinkedList<T> temp_ll(other);
-    stack = temp_ll;
-    return temp_ll;
+    stack = other.get_stack_ref();
+    return *this;
   };
   ~Stack() { stack.release(); };
 
   void push(const T &value) { stack.add(value, false); }
-  void push(T &&value) { stack.add(value, false); }
+  void push(T &&value) { stack.add(std::move(value), false); }
 
   auto pop() -> T {
     PXD_ASSERT(!is_empty());
 
-    T top_value = stack[0];
+    T top_value = std::move(stack[0]);
     stack.remove_at(0);
 
     return top_value;
@@ -49,10 +52,21 @@ public:
   void reverse() { stack.reverse(); }
 
   auto is_empty() const -> bool { return stack.is_empty(); }
-  auto get_stack() const -> LinkedList<T> { return stack; }
+  auto get_stack() const -> Container { return stack; }
   auto get_length() const -> int { return stack.get_length(); }
 
+  /// @brief inspect the storage without copying it
+  /// @return the storage of the stack
+  auto get_stack_ref() const noexcept -> const Container & { return stack; }
+
+  /// @brief move the storage out of the stack, the stack is empty afterwards
+  /// @return the storage of the stack
+  auto take_stack() noexcept -> Container { return std::move(stack); }
+
 private:
-  LinkedList<T> stack;
+  Container stack;
 };
-} // namespace pxd
\ No newline at end of file
+
+/// @brief Stack which stores the values in a contiguous growable ring buffer
+template <typename T> using RingStack = Stack<T, DynamicRingBuffer<T>>;
+} // namespace pxd
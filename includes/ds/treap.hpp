@@ -1,8 +1,11 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "node_allocator.hpp"
 
-#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace pxd {
 
@@ -11,129 +14,181 @@ template <typename T> struct TreapNode {
   double priority = 0.0;
   TreapNode<T> *left = nullptr;
   TreapNode<T> *right = nullptr;
-  TreapNode<T> *parent = nullptr;
-
-  TreapNode(const T &_key, double _priority) {
-    key = _key;
-    priority = _priority;
-  }
-
-  void set_left(TreapNode<T> *node) {
-    left = node;
-    node->parent = this;
-  }
-
-  void set_right(TreapNode<T> *node) {
-    right = node;
-    node->parent = this;
-  }
+  // node count of the subtree, the node included
+  int size = 1;
 };
 
-/// @brief BST and min based heap integrated data structure
+/// @brief BST and min based heap integrated data structure. The keys are in
+/// the BST order, the smaller keys on the left and the equal and bigger keys
+/// on the right, and the priorities are in the min heap order. Every node
+/// keeps its subtree size for the order statistics. The keys are compared
+/// only with <
 /// @tparam T value type
-template <typename T> class Treap {
+/// @tparam NodeAllocator allocator of the nodes, the PoolNodeAllocator keeps
+/// them in the contiguous chunks, recycles the removed ones and releases the
+/// trivially destructible ones at once
+template <typename T,
+          template <typename> class NodeAllocator = DefaultNodeAllocator>
+class Treap {
+public:
+  using Node = TreapNode<T>;
+
 public:
   Treap() = default;
-  Treap(const Treap<T> &other) = default;
-  auto operator=(const Treap<T> &other) -> Treap & = default;
-  Treap(Treap<T> &&other) = default;
-  auto operator=(Treap<T> &&other) -> Treap & = default;
-  ~Treap() noexcept {}
+  Treap(const Treap &other) { root = copy_nodes(other.root); }
+  auto operator=(const Treap &other) -> Treap & {
+    if (this == &other) {
+      return *this;
+    }
 
-  constexpr void insert(T &key, double priority) {
-    TreapNode<T> *node = root;
-    TreapNode<T> *parent = nullptr;
-    TreapNode<T> *new_node = new TreapNode<T>(key, priority);
+    release();
+    root = copy_nodes(other.root);
 
-    while (node != nullptr) {
-      parent = node;
-
-      if (node.key <= key) {
-        node = node->left;
-      } else {
-        node = node->right;
-      }
+    return *this;
+  }
+  Treap(Treap &&other) noexcept
+      : root(other.root), node_allocator(std::move(other.node_allocator)) {
+    other.exec_move();
+  }
+  auto operator=(Treap &&other) noexcept -> Treap & {
+    if (this == &other) {
+      return *this;
     }
 
-    if (parent == nullptr) {
-      root = new_node;
+    release();
+    root = other.root;
+    node_allocator = std::move(other.node_allocator);
+    other.exec_move();
+
+    return *this;
+  }
+  ~Treap() noexcept { release(); }
+
+  void release() noexcept {
+    // an empty treap keeps the reserved nodes of its pool
+    if (root == nullptr) {
       return;
-    } else if (key <= parent->key) {
-      parent->left = new_node;
+    }
+
+    if constexpr (NodeAllocator<Node>::owns_nodes &&
+                  std::is_trivially_destructible_v<Node>) {
+      // the chunks are freed without a walk of the nodes
+      node_allocator.release_all();
     } else {
-      parent->right = new_node;
+      release_nodes(root);
     }
 
-    new_node->parent = parent;
+    exec_move();
+  }
 
-    while (new_node->parent != nullptr &&
-           new_node->priority < new_node->parent->priority) {
-      if (new_node == new_node->parent->left) {
-        right_rotate(new_node);
-      } else {
-        left_rotate(new_node);
+  /// @brief reserve the nodes for the inserts, only the pool allocators
+  /// use it
+  void reserve(int node_count) { node_allocator.reserve(node_count); }
+
+  /// @brief build the treap from the sorted keys in O(n), the right spine is
+  /// kept in a stack like a Cartesian tree. The old keys are removed
+  /// @param keys keys in the strictly ascending order
+  /// @param priorities priority of every key
+  /// @param size key count
+  void from_sorted(const T *keys, const double *priorities, int size) {
+    release();
+
+    std::vector<Node *> right_spine;
+
+    for (int i = 0; i < size; i++) {
+      PXD_ASSERT(i == 0 || keys[i - 1] < keys[i]);
+
+      Node *node = create_node(keys[i], priorities[i]);
+      Node *last_popped = nullptr;
+
+      // a popped node is final, its right child was popped before it
+      while (!right_spine.empty() &&
+             node->priority < right_spine.back()->priority) {
+        last_popped = right_spine.back();
+        right_spine.pop_back();
+        update_size(last_popped);
       }
-    }
 
-    if (new_node->parent == nullptr) {
-      root = new_node;
-    }
-  }
+      node->left = last_popped;
 
-  void remove(const T &key) {
-    TreapNode<T> *node = search_node(root, key);
+      if (!right_spine.empty()) {
+        right_spine.back()->right = node;
+      }
 
-    if (node == nullptr) {
-      return;
+      right_spine.push_back(node);
     }
 
-    if (root == node && node->left == nullptr && node->right == nullptr) {
-      root = nullptr;
-      return;
+    update_sizes(right_spine);
+
+    root = right_spine.empty() ? nullptr : right_spine[0];
+  }
+
+  /// @brief insert the key, it goes down until its priority is the lowest
+  /// and the subtree there is split around it
+  /// @param key new key, the equal keys are kept
+  /// @param priority heap priority of the key
+  void insert(const T &key, double priority) {
+    Node **link = &root;
+
+    while (*link != nullptr && (*link)->priority <= priority) {
+      (*link)->size++;
+      link = key < (*link)->key ? &(*link)->left : &(*link)->right;
     }
 
-    node->priority = std::numeric_limits<double>::max();
+    Node *new_node = create_node(key, priority);
+    split_nodes(*link, key, new_node->left, new_node->right);
+    update_size(new_node);
 
-    while (node->left != nullptr || node->right != nullptr) {
-      if (node->left != nullptr &&
-          (node->right == nullptr ||
-           node->left->priority > node->right->priority)) {
-        right_rotate(node->left);
-      } else {
-        left_rotate(node->right);
-      }
+    *link = new_node;
+  }
 
-      if (node->parent == root) {
-        root = node->parent;
-      }
+  /// @brief remove a node of the key, its children are joined in its place
+  /// @param key the key
+  /// @return true if the key was in the treap
+  auto remove(const T &key) -> bool {
+    if (search_node(key) == nullptr) {
+      return false;
     }
 
-    if (node->parent->left == node) {
-      node->parent->left = nullptr;
-    } else {
-      node->parent->right = nullptr;
+    Node **link = &root;
+
+    while (key < (*link)->key || (*link)->key < key) {
+      (*link)->size--;
+      link = key < (*link)->key ? &(*link)->left : &(*link)->right;
     }
+
+    Node *node = *link;
+    *link = join_nodes(node->left, node->right);
+
+    node_allocator.deallocate(node);
+
+    return true;
   }
 
+  /// @brief remove the key with the lowest priority
+  /// @return the key of the root
   auto top() -> T {
-    PXD_ASSERT(root == nullptr);
-    T key = root->key;
+    PXD_ASSERT(root != nullptr);
+
+    Node *node = root;
+    T key = node->key;
 
-    remove(key);
+    root = join_nodes(node->left, node->right);
+    node_allocator.deallocate(node);
 
     return key;
   }
 
-  auto peek() -> T {
-    PXD_ASSERT(root == nullptr);
+  auto peek() const -> const T & {
+    PXD_ASSERT(root != nullptr);
 
     return root->key;
   }
 
-  auto min() -> T {
-    PXD_ASSERT(root == nullptr);
+  auto min() const -> const T & {
+    PXD_ASSERT(root != nullptr);
 
-    TreapNode<T> *node = root;
+    Node *node = root;
 
     while (node->left != nullptr) {
       node = node->left;
@@ -142,10 +197,10 @@ public:
     return node->key;
   }
 
-  auto max() -> T {
-    PXD_ASSERT(root == nullptr);
+  auto max() const -> const T & {
+    PXD_ASSERT(root != nullptr);
 
-    TreapNode<T> *node = root;
+    Node *node = root;
 
     while (node->right != nullptr) {
       node = node->right;
@@ -154,80 +209,313 @@ public:
     return node->key;
   }
 
-  auto contains(const T &key) -> bool {
-    PXD_ASSERT(root != nullptr);
+  auto contains(const T &key) const -> bool {
+    return search_node(key) != nullptr;
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Split and Join
+
+  /// @brief move the keys which are equal or bigger than the key to a new
+  /// treap, O(log n). The nodes of an allocator which owns them can not be
+  /// handed over, so the moved keys are copied to the allocator of the new
+  /// treap, O(log n + m)
+  /// @param key the split key
+  /// @return the treap of the keys >= key, this keeps the keys < key
+  auto split(const T &key) -> Treap {
+    Treap right_treap;
+    Node *right_root = nullptr;
+    split_nodes(root, key, root, right_root);
+
+    if constexpr (NodeAllocator<Node>::owns_nodes) {
+      right_treap.root = right_treap.copy_nodes(right_root);
+      release_nodes(right_root);
+    } else {
+      right_treap.root = right_root;
+    }
+
+    return right_treap;
+  }
+
+  /// @brief append the keys of the other treap, O(log n). The allocator of
+  /// this treap takes over the nodes of the other
+  /// @param other treap of the keys which are all bigger than the keys of this
+  /// treap, it is emptied
+  void join(Treap &&other) {
+    PXD_ASSERT(root == nullptr || other.root == nullptr ||
+               max() < other.min());
+
+    if (this == &other) {
+      return;
+    }
+
+    root = join_nodes(root, other.root);
+    node_allocator.adopt(std::move(other.node_allocator));
+    other.exec_move();
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Order Statistics
+
+  /// @brief the key of the given order, O(log n)
+  /// @param k zero based index of the key in the ascending order
+  auto kth(int k) const -> const T & {
+    PXD_ASSERT(k >= 0 && k < get_size());
+
+    Node *node = root;
+
+    while (true) {
+      const int left_size = get_size(node->left);
+
+      if (k < left_size) {
+        node = node->left;
+      } else if (k == left_size) {
+        return node->key;
+      } else {
+        k -= left_size + 1;
+        node = node->right;
+      }
+    }
+  }
+
+  /// @brief the count of the keys which are smaller than the key, O(log n)
+  auto rank(const T &key) const -> int {
+    int count = 0;
+    Node *node = root;
+
+    while (node != nullptr) {
+      if (node->key < key) {
+        count += get_size(node->left) + 1;
+        node = node->right;
+      } else {
+        node = node->left;
+      }
+    }
 
-    return search_node(root, key) != nullptr ? true : false;
+    return count;
   }
 
+  /// @brief the count of the keys in [low, high], O(log n)
+  auto range_count(const T &low, const T &high) const -> int {
+    if (high < low) {
+      return 0;
+    }
+
+    return get_upper_rank(high) - rank(low);
+  }
+
+  /// @brief the keys in [low, high] in the ascending order, O(log n + m)
+  auto range_query(const T &low, const T &high) const -> std::vector<T> {
+    std::vector<T> keys;
+
+    if (!(high < low)) {
+      keys.reserve(range_count(low, high));
+      collect_range(root, low, high, keys);
+    }
+
+    return keys;
+  }
+
+  auto get_size() const noexcept -> int { return get_size(root); }
+  auto is_empty() const noexcept -> bool { return root == nullptr; }
+
 private:
-  /// @brief rotate left node to parent node
-  /// @param node left node
-  void right_rotate(TreapNode<T> *node) {
-    PXD_ASSERT(node != nullptr && root != node);
+  void exec_move() noexcept { root = nullptr; }
 
-    TreapNode<T> *node_parent = node->parent;
+  /// @brief the count of the keys which are smaller than or equal to the key
+  auto get_upper_rank(const T &key) const -> int {
+    int count = 0;
+    Node *node = root;
 
-    PXD_ASSERT(node == node_parent->left);
+    while (node != nullptr) {
+      if (key < node->key) {
+        node = node->left;
+      } else {
+        count += get_size(node->left) + 1;
+        node = node->right;
+      }
+    }
 
-    TreapNode<T> *node_upperparent = node_parent->parent;
+    return count;
+  }
 
-    if (node_upperparent == nullptr) {
-      root == node;
-    } else {
-      if (node_upperparent->left == node_parent) {
-        node_upperparent->set_left(node);
+  auto search_node(const T &key) const -> Node * {
+    Node *node = root;
+
+    while (node != nullptr) {
+      if (key < node->key) {
+        node = node->left;
+      } else if (node->key < key) {
+        node = node->right;
       } else {
-        node_upperparent->set_right(node);
+        return node;
       }
     }
 
-    node_parent->set_left(node->right);
-    node->set_right(node_parent);
+    return nullptr;
   }
 
-  /// @brief rotate right node to parent node
-  /// @param node right node
-  void left_rotate(TreapNode<T> *node) {
-    PXD_ASSERT(node != nullptr && root != node);
+  /// @brief in order walk of the keys in [low, high], iterative, the
+  /// subtrees out of the range are skipped
+  static void collect_range(Node *node, const T &low, const T &high,
+                            std::vector<T> &keys) {
+    std::vector<Node *> nodes;
 
-    TreapNode<T> *node_parent = node->parent;
+    while (node != nullptr || !nodes.empty()) {
+      while (node != nullptr) {
+        nodes.push_back(node);
+        node = low < node->key ? node->left : nullptr;
+      }
 
-    PXD_ASSERT(node == node_parent->right);
+      node = nodes.back();
+      nodes.pop_back();
 
-    TreapNode<T> *node_upperparent = node_parent->parent;
+      if (!(node->key < low) && !(high < node->key)) {
+        keys.push_back(node->key);
+      }
 
-    if (node_upperparent == nullptr) {
-      root == node;
-    } else {
-      if (node_upperparent->left == node_parent) {
-        node_upperparent->set_left(node);
+      node = !(high < node->key) ? node->right : nullptr;
+    }
+  }
+
+  /// @brief split the subtree into the keys < key and the keys >= key, the
+  /// node may be one of the outputs. Iterative, the tree of the given
+  /// priorities can be a list, the nodes are hung on the ends of the two
+  /// outputs on the way down and their sizes are updated on the way back
+  static void split_nodes(Node *node, const T &key, Node *&left,
+                          Node *&right) {
+    Node **left_link = &left;
+    Node **right_link = &right;
+    std::vector<Node *> path;
+
+    while (node != nullptr) {
+      path.push_back(node);
+
+      if (node->key < key) {
+        *left_link = node;
+        left_link = &node->right;
+        node = node->right;
       } else {
-        node_upperparent->set_right(node);
+        *right_link = node;
+        right_link = &node->left;
+        node = node->left;
       }
     }
 
-    node_parent->set_right(node->left);
-    node->set_left(node_parent);
+    *left_link = nullptr;
+    *right_link = nullptr;
+
+    update_sizes(path);
   }
 
-  TreapNode<T> *search_node(TreapNode<T> *node, T &key) {
-    if (node == nullptr) {
-      return nullptr;
+  /// @brief join the subtrees, the keys of the left are smaller than the keys
+  /// of the right. Iterative like the split
+  /// @return root of the joined subtree
+  static auto join_nodes(Node *left, Node *right) -> Node * {
+    Node *joined = nullptr;
+    Node **link = &joined;
+    std::vector<Node *> path;
+
+    while (left != nullptr && right != nullptr) {
+      if (left->priority < right->priority) {
+        *link = left;
+        path.push_back(left);
+        link = &left->right;
+        left = left->right;
+      } else {
+        *link = right;
+        path.push_back(right);
+        link = &right->left;
+        right = right->left;
+      }
     }
 
-    if (node.key == key) {
-      return node;
+    *link = left != nullptr ? left : right;
+
+    update_sizes(path);
+
+    return joined;
+  }
+
+  auto create_node(const T &key, double priority) -> Node * {
+    Node *node = node_allocator.allocate();
+    node->key = key;
+    node->priority = priority;
+
+    return node;
+  }
+
+  /// @brief copy the nodes to the allocator of this treap, iterative, every
+  /// copied node is hung on the link of its parent copy
+  auto copy_nodes(const Node *node) -> Node * {
+    Node *new_root = nullptr;
+    std::vector<std::pair<const Node *, Node **>> nodes;
+
+    if (node != nullptr) {
+      nodes.emplace_back(node, &new_root);
     }
 
-    if (node.key < key) {
-      return search_node(node.left, key);
-    } else {
-      return search_node(node.right, key);
+    while (!nodes.empty()) {
+      const auto [source, link] = nodes.back();
+      nodes.pop_back();
+
+      Node *new_node = create_node(source->key, source->priority);
+      new_node->size = source->size;
+      *link = new_node;
+
+      if (source->left != nullptr) {
+        nodes.emplace_back(source->left, &new_node->left);
+      }
+
+      if (source->right != nullptr) {
+        nodes.emplace_back(source->right, &new_node->right);
+      }
+    }
+
+    return new_root;
+  }
+
+  /// @brief give the nodes back to the allocator, iterative, the tree of the
+  /// given priorities can be a list
+  void release_nodes(Node *node) noexcept {
+    std::vector<Node *> nodes;
+
+    if (node != nullptr) {
+      nodes.push_back(node);
+    }
+
+    while (!nodes.empty()) {
+      node = nodes.back();
+      nodes.pop_back();
+
+      if (node->left != nullptr) {
+        nodes.push_back(node->left);
+      }
+
+      if (node->right != nullptr) {
+        nodes.push_back(node->right);
+      }
+
+      node_allocator.deallocate(node);
+    }
+  }
+
+  static auto get_size(const Node *node) noexcept -> int {
+    return node != nullptr ? node->size : 0;
+  }
+  static void update_size(Node *node) noexcept {
+    node->size = get_size(node->left) + get_size(node->right) + 1;
+  }
+  /// @brief update the sizes of the walked path from the bottom, a node is
+  /// updated after its child
+  static void update_sizes(const std::vector<Node *> &path) noexcept {
+    for (int i = static_cast<int>(path.size()) - 1; i >= 0; i--) {
+      update_size(path[i]);
     }
   }
 
 private:
-  TreapNode<T> *root = nullptr;
+  Node *root = nullptr;
+  NodeAllocator<Node> node_allocator;
 };
-} // namespace pxd
\ No newline at end of file
+} // namespace pxd
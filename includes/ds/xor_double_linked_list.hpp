@@ -1,12 +1,14 @@
 #pragma once
 
 #include "../checks.hpp"
+#include "node_allocator.hpp"
 
 #include <cstdint>
 
 namespace pxd {
 
-template <typename T> class XORDoubleLinkedList {
+template <typename T, template <typename> class NodeAllocator>
+class XORDoubleLinkedList {
 public:
   struct Node {
     T value;
@@ -18,10 +20,10 @@ public:
   // Constructors
   XORDoubleLinkedList() = default;
   XORDoubleLinkedList(T *array, int size) { from_array(array, size); }
-  XORDoubleLinkedList(const XORDoubleLinkedList<T> &other) {
+  XORDoubleLinkedList(const XORDoubleLinkedList &other) {
     from_xor_dll(other);
   }
-  auto operator=(const XORDoubleLinkedList<T> &other) -> XORDoubleLinkedList & {
+  auto operator=(const XORDoubleLinkedList &other) -> XORDoubleLinkedList & {
     if (other.get_head_node() == head) {
       return *this;
     }
@@ -30,9 +32,8 @@ public:
 
     return *this;
   }
-  XORDoubleLinkedList(XORDoubleLinkedList<T> &&other) noexcept {
-    release();
-
+  XORDoubleLinkedList(XORDoubleLinkedList &&other) noexcept
+      : node_allocator(std::move(other.node_allocator)) {
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
@@ -40,12 +41,13 @@ public:
     other.exec_move();
   }
   auto
-  operator=(XORDoubleLinkedList<T> &&other) noexcept -> XORDoubleLinkedList & {
+  operator=(XORDoubleLinkedList &&other) noexcept -> XORDoubleLinkedList & {
     release();
 
     head = other.get_head_node();
     end = other.get_end_node();
     length = other.get_length();
+    node_allocator = std::move(other.node_allocator);
 
     other.exec_move();
 
@@ -102,7 +104,7 @@ public:
       next_node = XOR(prev_node, current_node->dir);
       prev_node = current_node;
 
-      delete current_node;
+      node_allocator.deallocate(current_node);
       current_node = nullptr;
 
       current_node = next_node;
@@ -117,7 +119,7 @@ public:
   /// @param value the value wants to be added
   /// @param add_back true add to the end, false add at to the head
   void add(T &value, bool add_back = true) noexcept {
-    Node *new_node = new Node();
+    Node *new_node = node_allocator.allocate();
     new_node->value = value;
 
     if (add_back) {
@@ -174,6 +176,11 @@ public:
   /// @param value the given value
   void remove(T &&value) { remove(value); }
 
+  /// @brief prepare the node allocator for the given node count, only the
+  /// PoolNodeAllocator pre-allocates the nodes
+  /// @param node_count wanted node count
+  void reserve(int node_count) { node_allocator.reserve(node_count); }
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////
   // From Functions
 
@@ -248,10 +255,11 @@ private:
     return is_negative ? negative_index : positive_index;
   }
 
-  void from_xor_dll(const XORDoubleLinkedList<T> &other) {
+  void from_xor_dll(const XORDoubleLinkedList &other) {
     release();
 
     const int other_length = other.get_length();
+    node_allocator.reserve(other_length);
 
     Node *current_node = other.get_head_node();
     Node *prev_node = nullptr;
@@ -270,7 +278,10 @@ private:
       return;
     }
 
-    if (current_node == head) {
+    if (current_node == head && current_node == end) {
+      head = nullptr;
+      end = nullptr;
+    } else if (current_node == head) {
       Node *next_node = XOR(nullptr, current_node->dir);
       Node *next_next_node = XOR(current_node, next_node->dir);
 
@@ -294,7 +305,7 @@ private:
       next_node->dir = XOR(prev_node, next_next_node);
     }
 
-    delete current_node;
+    node_allocator.deallocate(current_node);
     current_node = nullptr;
 
     if (head == nullptr) {
@@ -305,6 +316,7 @@ private:
   }
 
 private:
+  NodeAllocator<Node> node_allocator;
   Node *head = nullptr;
   Node *end = nullptr;
   int length = 0;
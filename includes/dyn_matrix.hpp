@@ -0,0 +1,454 @@
+#pragma once
+
+#include "checks.hpp"
+#include "matrix_kernels.hpp"
+#include "matrix_view.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace pxd {
+
+constexpr int PXD_DYN_MATRIX_ALIGNMENT = 64;
+// the c block of a multiply task and the depth which is walked at once, a
+// depth x column block of b stays in the l2 cache
+constexpr int PXD_DYN_MATRIX_BLOCK_ROW = 64;
+constexpr int PXD_DYN_MATRIX_BLOCK_COLUMN = 256;
+constexpr int PXD_DYN_MATRIX_BLOCK_DEPTH = 256;
+
+/// @brief heap backed matrix with the runtime dimensions. Every row (every
+/// column for the column ordered matrices) starts on a 64 byte boundary, the
+/// stride is padded with zeros for that
+/// @tparam T trivially copyable value type
+template <typename T> class DynMatrix {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "DynMatrix values are copied with memcpy");
+
+public:
+  DynMatrix() = default;
+  /// @brief zero filled row x column matrix
+  /// @param b_row_order true the rows are contiguous, false the columns are
+  DynMatrix(int row, int column, bool b_row_order = true) {
+    init(row, column, b_row_order);
+  }
+  /// @brief copy the packed values, they are in the given order
+  DynMatrix(const T *values, int row, int column, bool b_row_order = true) {
+    init(row, column, b_row_order);
+    from_array(values);
+  }
+  DynMatrix(const DynMatrix &other) { from_dyn_matrix(other); }
+  auto operator=(const DynMatrix &other) -> DynMatrix & {
+    if (this == &other) {
+      return *this;
+    }
+
+    from_dyn_matrix(other);
+
+    return *this;
+  }
+  DynMatrix(DynMatrix &&other) noexcept
+      : matrix(other.matrix), row(other.row), column(other.column),
+        stride(other.stride), b_row_order(other.b_row_order) {
+    other.exec_move();
+  }
+  auto operator=(DynMatrix &&other) noexcept -> DynMatrix & {
+    if (this == &other) {
+      return *this;
+    }
+
+    release();
+
+    matrix = other.matrix;
+    row = other.row;
+    column = other.column;
+    stride = other.stride;
+    b_row_order = other.b_row_order;
+
+    other.exec_move();
+
+    return *this;
+  }
+  ~DynMatrix() noexcept { release(); }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Operator Overloads
+
+  auto operator()(int row, int column) noexcept -> T & {
+    return matrix[get_index(row, column)];
+  }
+  auto operator()(int row, int column) const noexcept -> const T & {
+    return matrix[get_index(row, column)];
+  }
+
+  /// @brief view of the row, only the row ordered matrices have contiguous
+  /// rows
+  auto operator[](int index) noexcept -> RowView<T> {
+    return get_row_view(index);
+  }
+  auto operator[](int index) const noexcept -> RowView<const T> {
+    return get_row_view(index);
+  }
+
+  auto operator+=(const DynMatrix &other) -> DynMatrix & {
+    add(other);
+    return *this;
+  }
+  auto operator-=(const DynMatrix &other) -> DynMatrix & {
+    sub(other);
+    return *this;
+  }
+  auto operator*=(T scalar) noexcept -> DynMatrix & {
+    scale(scalar);
+    return *this;
+  }
+
+  auto operator+(const DynMatrix &other) const -> DynMatrix {
+    DynMatrix result(*this);
+    result.add(other);
+    return result;
+  }
+  auto operator-(const DynMatrix &other) const -> DynMatrix {
+    DynMatrix result(*this);
+    result.sub(other);
+    return result;
+  }
+  auto operator*(T scalar) const -> DynMatrix {
+    DynMatrix result(*this);
+    result.scale(scalar);
+    return result;
+  }
+  auto operator*(const DynMatrix &other) const -> DynMatrix {
+    return multiply(other);
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // View Functions
+
+  auto get_row_view(int index) noexcept -> RowView<T> {
+    PXD_ASSERT(b_row_order && index >= 0 && index < row);
+
+    return RowView<T>(matrix + get_offset(index), column);
+  }
+  auto get_row_view(int index) const noexcept -> RowView<const T> {
+    PXD_ASSERT(b_row_order && index >= 0 && index < row);
+
+    return RowView<const T>(matrix + get_offset(index), column);
+  }
+
+  auto get_column_view(int index) noexcept -> ColumnView<T> {
+    PXD_ASSERT(index >= 0 && index < column);
+
+    if (b_row_order) {
+      return ColumnView<T>(matrix + index, row, stride);
+    }
+
+    return ColumnView<T>(matrix + get_offset(index), row, 1);
+  }
+  auto get_column_view(int index) const noexcept -> ColumnView<const T> {
+    PXD_ASSERT(index >= 0 && index < column);
+
+    if (b_row_order) {
+      return ColumnView<const T>(matrix + index, row, stride);
+    }
+
+    return ColumnView<const T>(matrix + get_offset(index), row, 1);
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Arithmetic Functions
+
+  /// @brief add the values of the other matrix element by element
+  /// @param other matrix with the same shape
+  void add(const DynMatrix &other) {
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    if (b_row_order == other.is_row_order()) {
+      // the padding is zero in both of them and stays zero
+      matrix_add(matrix, other.get_ptr(), matrix, get_storage_size());
+      return;
+    }
+
+    for (int i = 0; i < row; i++) {
+      for (int j = 0; j < column; j++) {
+        (*this)(i, j) += other(i, j);
+      }
+    }
+  }
+
+  /// @brief subtract the values of the other matrix element by element
+  /// @param other matrix with the same shape
+  void sub(const DynMatrix &other) {
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    if (b_row_order == other.is_row_order()) {
+      matrix_sub(matrix, other.get_ptr(), matrix, get_storage_size());
+      return;
+    }
+
+    for (int i = 0; i < row; i++) {
+      for (int j = 0; j < column; j++) {
+        (*this)(i, j) -= other(i, j);
+      }
+    }
+  }
+
+  /// @brief multiply all the values with the scalar
+  /// @param scalar the multiplier
+  void scale(T scalar) noexcept {
+    matrix_scale(matrix, scalar, matrix, get_storage_size());
+  }
+
+  /// @brief matrix product on the shared thread pool
+  /// @param other column x other column matrix
+  /// @return row ordered row x other column product
+  auto multiply(const DynMatrix &other) const -> DynMatrix {
+    return multiply(other, ThreadPool::get_default());
+  }
+
+  /// @brief matrix product, the product is split into the cache sized blocks
+  /// and every block is a task of the thread pool. The column ordered
+  /// operands are copied to the row order first
+  /// @param other column x other column matrix
+  /// @param thread_pool pool which computes the blocks
+  /// @return row ordered row x other column product
+  auto multiply(const DynMatrix &other, ThreadPool &thread_pool) const
+      -> DynMatrix {
+    PXD_ASSERT(column == other.get_row());
+
+    DynMatrix left_copy;
+    DynMatrix right_copy;
+    const DynMatrix &left = get_row_ordered(*this, left_copy);
+    const DynMatrix &right = get_row_ordered(other, right_copy);
+
+    DynMatrix result(row, other.get_column());
+
+    const int depth = column;
+    const int result_column = other.get_column();
+    const int row_blocks =
+        (row + PXD_DYN_MATRIX_BLOCK_ROW - 1) / PXD_DYN_MATRIX_BLOCK_ROW;
+    const int column_blocks =
+        (result_column + PXD_DYN_MATRIX_BLOCK_COLUMN - 1) /
+        PXD_DYN_MATRIX_BLOCK_COLUMN;
+
+    // b is copied to the column panels once, the rows of a panel are packed
+    // next to each other. The rows of b are a power of two apart for the
+    // common sizes and they would evict each other from the cache
+    DynMatrix packed(column_blocks * depth, PXD_DYN_MATRIX_BLOCK_COLUMN);
+    const int packed_stride = packed.get_stride();
+
+    thread_pool.parallel_for(column_blocks, [&](int column_block) {
+      const int column_start = column_block * PXD_DYN_MATRIX_BLOCK_COLUMN;
+      const int block_column =
+          std::min(PXD_DYN_MATRIX_BLOCK_COLUMN, result_column - column_start);
+      T *panel = packed.get_data() + packed.get_offset(column_block * depth);
+
+      for (int k = 0; k < depth; k++) {
+        memcpy(panel + static_cast<std::ptrdiff_t>(k) * packed_stride,
+               right.get_ptr() + right.get_offset(k) + column_start,
+               block_column * sizeof(T));
+      }
+    });
+
+    const T *a = left.get_ptr();
+    const T *b = packed.get_ptr();
+    T *c = result.get_data();
+    const int a_stride = left.get_stride();
+    const int c_stride = result.get_stride();
+
+    thread_pool.parallel_for(row_blocks * column_blocks, [&](int task) {
+      const int row_start = task / column_blocks * PXD_DYN_MATRIX_BLOCK_ROW;
+      const int column_block = task % column_blocks;
+      const int column_start = column_block * PXD_DYN_MATRIX_BLOCK_COLUMN;
+      const int block_row =
+          std::min(PXD_DYN_MATRIX_BLOCK_ROW, row - row_start);
+      const int block_column =
+          std::min(PXD_DYN_MATRIX_BLOCK_COLUMN, result_column - column_start);
+      const T *panel = b + packed.get_offset(column_block * depth);
+
+      for (int k = 0; k < depth; k += PXD_DYN_MATRIX_BLOCK_DEPTH) {
+        const int block_depth = std::min(PXD_DYN_MATRIX_BLOCK_DEPTH, depth - k);
+
+        matrix_multiply_add(
+            a + left.get_offset(row_start) + k, a_stride,
+            panel + static_cast<std::ptrdiff_t>(k) * packed_stride,
+            packed_stride, c + result.get_offset(row_start) + column_start,
+            c_stride, block_row, block_depth, block_column);
+      }
+    });
+
+    return result;
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // DS Functionalities
+
+  void release() noexcept {
+    if (matrix != nullptr) {
+      ::operator delete(matrix, std::align_val_t(PXD_DYN_MATRIX_ALIGNMENT));
+    }
+
+    exec_move();
+  }
+
+  void fill(T value) noexcept {
+    for (int i = 0; i < row; i++) {
+      for (int j = 0; j < column; j++) {
+        (*this)(i, j) = value;
+      }
+    }
+  }
+
+  /// @brief transpose without moving the values, the row ordered storage of
+  /// the matrix is the column ordered storage of its transpose. Use
+  /// change_order to get the original order back
+  void transpose() noexcept {
+    std::swap(row, column);
+    b_row_order = !b_row_order;
+  }
+
+  /// @brief store the same matrix in the other order, the values are moved
+  /// with the blocked transpose
+  void change_order() {
+    DynMatrix other(row, column, !b_row_order);
+
+    matrix_transpose(matrix, stride, other.get_data(), other.get_stride(),
+                     get_line_count(), get_line_length());
+
+    *this = std::move(other);
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // To Functions
+
+  /// @brief copy the values to the packed array in the matrix's order
+  void to_array(T *values) const {
+    const int line_length = get_line_length();
+
+    for (int i = 0; i < get_line_count(); i++) {
+      memcpy(values + static_cast<std::ptrdiff_t>(i) * line_length,
+             matrix + get_offset(i), line_length * sizeof(T));
+    }
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Inline Member Funcs
+
+  auto get_ptr() const noexcept -> const T * { return matrix; }
+  auto get_data() noexcept -> T * { return matrix; }
+  auto get_row() const noexcept -> int { return row; }
+  auto get_column() const noexcept -> int { return column; }
+  /// @brief distance between the starts of the rows, or the columns for the
+  /// column ordered matrices
+  auto get_stride() const noexcept -> int { return stride; }
+  auto get_element_count() const noexcept -> int { return row * column; }
+  auto get_byte_size() const noexcept -> std::size_t {
+    return static_cast<std::size_t>(get_element_count()) * sizeof(T);
+  }
+  auto is_row_order() const noexcept -> bool { return b_row_order; }
+  auto is_empty() const noexcept -> bool { return matrix == nullptr; }
+
+  constexpr void exec_move() noexcept {
+    matrix = nullptr;
+    row = 0;
+    column = 0;
+    stride = 0;
+    b_row_order = true;
+  }
+
+private:
+  void init(int row, int column, bool b_row_order) {
+    PXD_ASSERT(row >= 0 && column >= 0);
+
+    // the stride is rounded up to keep every line 64 byte aligned
+    constexpr int alignment_elements =
+        PXD_DYN_MATRIX_ALIGNMENT /
+        std::gcd(PXD_DYN_MATRIX_ALIGNMENT, static_cast<int>(sizeof(T)));
+
+    this->row = row;
+    this->column = column;
+    this->b_row_order = b_row_order;
+
+    const int line_length = get_line_length();
+    stride = (line_length + alignment_elements - 1) / alignment_elements *
+             alignment_elements;
+
+    const std::size_t storage_size = get_storage_size();
+
+    if (storage_size == 0) {
+      matrix = nullptr;
+      return;
+    }
+
+    matrix = static_cast<T *>(
+        ::operator new(storage_size * sizeof(T),
+                       std::align_val_t(PXD_DYN_MATRIX_ALIGNMENT)));
+    std::fill_n(matrix, storage_size, T{});
+  }
+
+  void from_array(const T *values) {
+    const int line_length = get_line_length();
+
+    for (int i = 0; i < get_line_count(); i++) {
+      memcpy(matrix + get_offset(i),
+             values + static_cast<std::ptrdiff_t>(i) * line_length,
+             line_length * sizeof(T));
+    }
+  }
+
+  void from_dyn_matrix(const DynMatrix &other) {
+    release();
+    init(other.get_row(), other.get_column(), other.is_row_order());
+
+    if (matrix != nullptr) {
+      memcpy(matrix, other.get_ptr(), get_storage_size() * sizeof(T));
+    }
+  }
+
+  static auto get_row_ordered(const DynMatrix &matrix, DynMatrix &copy)
+      -> const DynMatrix & {
+    if (matrix.is_row_order()) {
+      return matrix;
+    }
+
+    copy = matrix;
+    copy.change_order();
+
+    return copy;
+  }
+
+  // a line is a row for the row ordered matrices and a column for the column
+  // ordered matrices
+  auto get_line_count() const noexcept -> int {
+    return b_row_order ? row : column;
+  }
+  auto get_line_length() const noexcept -> int {
+    return b_row_order ? column : row;
+  }
+  auto get_offset(int line) const noexcept -> std::ptrdiff_t {
+    return static_cast<std::ptrdiff_t>(line) * stride;
+  }
+  auto get_storage_size() const noexcept -> int {
+    return get_line_count() * stride;
+  }
+
+  auto get_index(int row, int column) const noexcept -> std::ptrdiff_t {
+    PXD_ASSERT(row >= 0 && row < this->row && column >= 0 &&
+               column < this->column);
+
+    return b_row_order ? get_offset(row) + column : get_offset(column) + row;
+  }
+
+private:
+  T *matrix = nullptr;
+  int row = 0;
+  int column = 0;
+  int stride = 0;
+  bool b_row_order = true;
+};
+} // namespace pxd
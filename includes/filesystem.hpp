@@ -3,45 +3,46 @@
 #include "absl/str_join.hpp"
 #include <array>
 
-namespace pxd {
+#include "string.hpp"
 
-class String;
+namespace pxd {
 
-// pxd::fs
+// pxd::fs, the paths are StringViews so a String, a std::string or a slice is
+// passed without a copy
 namespace fs {
-auto exists(const char *path) -> bool;
-auto is_dir(const char *path) -> bool;
-auto is_file(const char *path) -> bool;
-void mkdir(const char *path);
-auto get_file_hash(const char *path) -> size_t;
-auto get_relative_path(const char *path) -> String;
-auto get_absolute_path(const char *path) -> String;
-auto create_file_symlink(const char *filepath, const char *symlink) -> bool;
-auto create_directory_symlink(const char *dirpath, const char *symlink) -> bool;
+auto exists(StringView path) -> bool;
+auto is_dir(StringView path) -> bool;
+auto is_file(StringView path) -> bool;
+void mkdir(StringView path);
+auto get_file_hash(StringView path) -> size_t;
+auto get_relative_path(StringView path) -> String;
+auto get_absolute_path(StringView path) -> String;
+auto create_file_symlink(StringView filepath, StringView symlink) -> bool;
+auto create_directory_symlink(StringView dirpath, StringView symlink) -> bool;
 auto getcwd() -> String;
-auto get_last_modified_time(const char *path) -> String;
-auto remove_file(const char *path) -> bool;
-auto remove_folder(const char *path) -> bool;
+auto get_last_modified_time(StringView path) -> String;
+auto remove_file(StringView path) -> bool;
+auto remove_folder(StringView path) -> bool;
 auto get_temp_dir_path() -> String;
-void copy_dir(const char *from_dir, const char *to_dir,
+void copy_dir(StringView from_dir, StringView to_dir,
               bool is_recursive = true, bool update_existed = true);
-void copy_file(const char *from_file, const char *to_file,
+void copy_file(StringView from_file, StringView to_file,
                bool update_existed = true);
-void rename(const char *_old, const char *_new);
+void rename(StringView _old, StringView _new);
 
 // pxd::fs::path
 namespace path {
-auto remove_filename(const char *path) -> String;
-auto replace_filename(const char *path, const char *new_filename) -> String;
-auto replace_extension(const char *path, const char *new_ext) -> String;
-auto get_root_name(const char *path) -> String;
-auto get_root_directory(const char *path) -> String;
-auto get_root_path(const char *path) -> String;
-auto get_relative_path(const char *path) -> String;
-auto get_parent_path(const char *path) -> String;
-auto get_filename(const char *path) -> String;
-auto get_filename_wo_ext(const char *path) -> String;
-auto get_extension_w_dot(const char *path) -> String;
+auto remove_filename(StringView path) -> String;
+auto replace_filename(StringView path, StringView new_filename) -> String;
+auto replace_extension(StringView path, StringView new_ext) -> String;
+auto get_root_name(StringView path) -> String;
+auto get_root_directory(StringView path) -> String;
+auto get_root_path(StringView path) -> String;
+auto get_relative_path(StringView path) -> String;
+auto get_parent_path(StringView path) -> String;
+auto get_filename(StringView path) -> String;
+auto get_filename_wo_ext(StringView path) -> String;
+auto get_extension_w_dot(StringView path) -> String;
 
 /// @brief contenate given paths with OS-based seperator character
 /// @tparam ...P value types that can be allocated by String class
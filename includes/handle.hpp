@@ -1,6 +1,7 @@
 #pragma once
 
 #include "checks.hpp"
+#include "ds/node_allocator.hpp"
 
 #include <cstddef>
 #include <utility>
@@ -50,7 +51,6 @@ private:
 };
 
 template <typename T> class Array;
-template <typename T> class LinkedList;
 
 template <typename T> class HandleArray {
 public:
@@ -5,8 +5,9 @@
 #include <array>
 #include <cstdint>
 
+#include "string.hpp"
+
 namespace pxd {
-class String;
 
 /// @brief compute the hash value of the data and store it in the
 /// computed_hash_values
@@ -22,6 +23,11 @@ void comp_hash(const void *data, size_t data_length,
 /// @return string value of the hash based on hex
 auto comp_and_get_hash_str(const void *data, size_t data_length) -> String;
 
+/// @brief compute the hash value of the viewed chars without a copy
+/// @param data a String, a std::string or a slice of them
+/// @return string value of the hash based on hex
+auto comp_and_get_hash_str(StringView data) -> String;
+
 /// @brief get the string value from the computed hashed values
 /// @param hashed_values precomputed hash values
 /// @param length length of the hashed_values, default to 32
@@ -32,26 +38,27 @@ auto get_hash_str(const std::array<uint8_t, BLAKE3_OUT_LEN> &hashed_values)
 /// @brief get the hash string from the file contents
 /// @param filepath filepath to the exists file
 /// @return computed hash string of the file contents
-auto get_file_content_hash_str(const char *filepath) -> String;
+auto get_file_content_hash_str(StringView filepath) -> String;
 
 auto update_hasher_with_file_content(blake3_hasher *hasher,
-                                     const char *filepath) -> bool;
+                                     StringView filepath) -> bool;
 
 template <typename... V>
 inline void join_and_comp_hash(uint8_t *computed_hash_values,
                                const V &...strings) {
-  const String values[] = {strings...};
+  // views of the given strings, they are not copied
+  const StringView values[] = {strings...};
   const int n = sizeof...(strings);
 
   blake3_hasher hasher;
   blake3_hasher_init(&hasher);
 
   for (int i = 0; i < n; ++i) {
-    if (update_hasher_with_file_content(&hasher, values[i].c_str())) {
+    if (update_hasher_with_file_content(&hasher, values[i])) {
       continue;
     }
 
-    blake3_hasher_update(&hasher, values[i].c_str(), values[i].length());
+    blake3_hasher_update(&hasher, values[i].data(), values[i].length());
   }
 
   blake3_hasher_finalize(&hasher, computed_hash_values, BLAKE3_OUT_LEN);
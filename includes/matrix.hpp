@@ -1,14 +1,16 @@
 #pragma once
 
 #include "checks.hpp"
+#include "matrix_kernels.hpp"
+#include "matrix_view.hpp"
 
 #include <array>
 #include <cstddef>
+#include <cstring>
+#include <utility>
 
 namespace pxd {
 
-template <typename T> class Array;
-
 template <typename T, size_t TotalRow, size_t TotalCol> class Matrix {
 public:
   constexpr Matrix() noexcept { init(); }
@@ -16,8 +18,10 @@ public:
     init();
     memcpy(matrix.data(), values, get_byte_size());
   }
-  Matrix(const Matrix<T, TotalRow, TotalCol> &other) {
-    init();
+  Matrix(const Matrix<T, TotalRow, TotalCol> &other)
+      : row(other.get_row()), column(other.get_column()),
+        element_count(other.get_element_count()),
+        b_row_order(other.is_row_order()) {
     memcpy(matrix.data(), other.get_ptr(), other.get_byte_size());
   }
   constexpr Matrix(Matrix<T, TotalRow, TotalCol> &&other) noexcept
@@ -41,12 +45,12 @@ public:
     return *this;
   }
   auto operator=(const Matrix<T, TotalRow, TotalCol> &other) -> Matrix & {
-    if (matrix == other.get_matrix()) {
+    if (this == &other) {
       return *this;
     }
 
     init();
-    memcpy(matrix.data(), other.get_matrix(), other.get_byte_size());
+    memcpy(matrix.data(), other.get_ptr(), other.get_byte_size());
 
     row = other.get_row();
     column = other.get_column();
@@ -58,14 +62,13 @@ public:
 
   ~Matrix() noexcept { release(); }
 
-  auto operator[](int index) -> decltype(auto) {
-    PXD_ASSERT(index < row);
-
-    int start_stride = index * column;
-
-    Array<T> row_array(matrix.data() + start_stride, column);
-
-    return row_array;
+  /// @brief view of the row, nothing is copied and the values are written
+  /// through to the matrix
+  auto operator[](int index) noexcept -> RowView<T> {
+    return get_row_view(index);
+  }
+  auto operator[](int index) const noexcept -> RowView<const T> {
+    return get_row_view(index);
   }
 
   auto operator()(int row, int column) -> decltype(auto) {
@@ -74,38 +77,132 @@ public:
     return matrix[row * this->column + column];
   }
 
-  void release() noexcept {
-    auto is_empty = matrix.empty();
+  auto operator+=(const Matrix &other) noexcept -> Matrix & {
+    add(other);
+    return *this;
+  }
+  auto operator-=(const Matrix &other) noexcept -> Matrix & {
+    sub(other);
+    return *this;
+  }
+  auto operator*=(T scalar) noexcept -> Matrix & {
+    scale(scalar);
+    return *this;
+  }
+
+  auto operator+(const Matrix &other) const -> Matrix {
+    Matrix result(*this);
+    result.add(other);
+    return result;
+  }
+  auto operator-(const Matrix &other) const -> Matrix {
+    Matrix result(*this);
+    result.sub(other);
+    return result;
+  }
+  auto operator*(T scalar) const -> Matrix {
+    Matrix result(*this);
+    result.scale(scalar);
+    return result;
+  }
+  template <size_t OtherCol>
+  auto operator*(const Matrix<T, TotalCol, OtherCol> &other) const
+      -> Matrix<T, TotalRow, OtherCol> {
+    return multiply(other);
+  }
 
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Arithmetic Functions
+
+  /// @brief add the values of the other matrix element by element
+  /// @param other matrix with the same shape
+  void add(const Matrix &other) noexcept {
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    matrix_add(matrix.data(), other.get_ptr(), matrix.data(), element_count);
+  }
+
+  /// @brief subtract the values of the other matrix element by element
+  /// @param other matrix with the same shape
+  void sub(const Matrix &other) noexcept {
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    matrix_sub(matrix.data(), other.get_ptr(), matrix.data(), element_count);
+  }
+
+  /// @brief multiply all the values with the scalar
+  /// @param scalar the multiplier
+  void scale(T scalar) noexcept {
+    matrix_scale(matrix.data(), scalar, matrix.data(), element_count);
+  }
+
+  /// @brief matrix product, the tiles of the result are kept in the registers
+  /// and the loops are unrolled for the template dimensions
+  /// @param other TotalCol x OtherCol matrix
+  /// @return TotalRow x OtherCol product
+  template <size_t OtherCol>
+  auto multiply(const Matrix<T, TotalCol, OtherCol> &other) const
+      -> Matrix<T, TotalRow, OtherCol> {
+    // the transposed non-square matrices do not have the template shape
+    PXD_ASSERT(row == static_cast<int>(TotalRow) &&
+               other.get_row() == static_cast<int>(TotalCol));
+
+    Matrix<T, TotalRow, OtherCol> result;
+    matrix_multiply<TotalRow, TotalCol, OtherCol>(
+        matrix.data(), other.get_ptr(), result.get_data());
+
+    return result;
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // View Functions
+
+  auto get_row_view(int index) noexcept -> RowView<T> {
+    PXD_ASSERT(index >= 0 && index < row);
+
+    return RowView<T>(matrix.data() + index * column, column);
+  }
+  auto get_row_view(int index) const noexcept -> RowView<const T> {
+    PXD_ASSERT(index >= 0 && index < row);
+
+    return RowView<const T>(matrix.data() + index * column, column);
+  }
+
+  auto get_column_view(int index) noexcept -> ColumnView<T> {
+    PXD_ASSERT(index >= 0 && index < column);
+
+    return ColumnView<T>(matrix.data() + index, row, column);
+  }
+  auto get_column_view(int index) const noexcept -> ColumnView<const T> {
+    PXD_ASSERT(index >= 0 && index < column);
+
+    return ColumnView<const T>(matrix.data() + index, row, column);
+  }
+
+  /// @brief view of the whole matrix with the current shape
+  auto get_view() noexcept -> MatrixView<T> {
+    return MatrixView<T>(matrix.data(), row, column);
+  }
+  auto get_view() const noexcept -> MatrixView<const T> {
+    return MatrixView<const T>(matrix.data(), row, column);
+  }
+
+  void release() noexcept {
     row = 0;
     column = 0;
     element_count = 0;
     b_row_order = true;
   }
 
+  /// @brief transpose the matrix block by block. The row and the column
+  /// counts are swapped, so a non-square matrix has the TotalCol x TotalRow
+  /// shape until it is transposed again
   void transpose() noexcept {
-    int current_row = 0;
-    int current_col = 0;
-    int normal_index = 0;
-    int transpose_index = 0;
-    T temp;
-
-    for (int i = 0; i < element_count; i++) {
-      current_row = i / row;
-      current_col = i % column;
-
-      normal_index = current_row * column + current_col;
-      transpose_index = current_col * column + current_row;
-
-      if (current_col == current_row) {
-        i += (column - current_col - 1);
-        continue;
-      }
-
-      temp = matrix[normal_index];
-      matrix[normal_index] = matrix[transpose_index];
-      matrix[transpose_index] = temp;
-    }
+    std::array<T, TotalRow * TotalCol> transposed;
+    matrix_transpose(matrix.data(), transposed.data(), row, column);
+
+    matrix = transposed;
+    std::swap(row, column);
 
     b_row_order = !b_row_order;
   }
@@ -120,6 +217,7 @@ public:
   }
   auto get_ptr() noexcept -> const T * { return matrix.data(); }
   auto get_ptr() const noexcept -> const T * { return matrix.data(); }
+  auto get_data() noexcept -> T * { return matrix.data(); }
   auto get_row() const noexcept -> int { return row; }
   auto get_column() const noexcept -> int { return column; }
   auto get_element_count() const noexcept -> int { return element_count; }
@@ -147,15 +245,11 @@ private:
 
   void from_array(T *values) {
     std::size_t byte_size = element_count * sizeof(T);
-    memcpy(matrix, values, byte_size);
+    memcpy(matrix.data(), values, byte_size);
   }
 
   void from_matrix(const Matrix<T, TotalRow, TotalCol> &other) {
-    memcpy(matrix, other.get_matrix(), other.get_byte_size());
-  }
-
-  void from_matrix(Matrix<T, TotalRow, TotalCol> other) {
-    memcpy(matrix, other.get_matrix(), other.get_byte_size());
+    memcpy(matrix.data(), other.get_ptr(), other.get_byte_size());
   }
 
 private:
@@ -0,0 +1,622 @@
+#pragma once
+
+#include "simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace pxd {
+
+constexpr int PXD_MATRIX_TRANSPOSE_BLOCK_SIZE = 16;
+// below this element count the dispatch costs more than the simd loop saves
+constexpr int PXD_MATRIX_SIMD_MIN_ELEMENTS = 64;
+
+/// @brief the types which use the simd element-wise and multiply kernels, the
+/// other types use the scalar loops
+template <typename T>
+constexpr bool is_simd_arithmetic_v =
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t>;
+
+namespace matrix_detail {
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// Scalar Kernels
+
+template <typename T>
+void add_scalar(const T *left, const T *right, T *out, int start, int size) {
+  for (int i = start; i < size; i++) {
+    out[i] = left[i] + right[i];
+  }
+}
+
+template <typename T>
+void sub_scalar(const T *left, const T *right, T *out, int start, int size) {
+  for (int i = start; i < size; i++) {
+    out[i] = left[i] - right[i];
+  }
+}
+
+template <typename T>
+void scale_scalar(const T *values, T scalar, T *out, int start, int size) {
+  for (int i = start; i < size; i++) {
+    out[i] = values[i] * scalar;
+  }
+}
+
+/// @brief c[row_start:M, col_start:N] = a * b, i-k-j order to read the rows
+/// of b sequentially
+template <size_t M, size_t K, size_t N, typename T>
+void multiply_scalar(const T *a, const T *b, T *c, int row_start,
+                     int col_start) {
+  for (int i = row_start; i < static_cast<int>(M); i++) {
+    for (int j = col_start; j < static_cast<int>(N); j++) {
+      c[i * N + j] = T{};
+    }
+
+    for (int k = 0; k < static_cast<int>(K); k++) {
+      const T a_value = a[i * K + k];
+
+      for (int j = col_start; j < static_cast<int>(N); j++) {
+        c[i * N + j] += a_value * b[k * N + j];
+      }
+    }
+  }
+}
+
+/// @brief c += a * b for the rows x depth a and the depth x cols b, the
+/// matrices are row ordered with the given strides
+template <typename T>
+void multiply_add_scalar(const T *a, int a_stride, const T *b, int b_stride,
+                         T *c, int c_stride, int rows, int depth, int cols,
+                         int col_start) {
+  for (int i = 0; i < rows; i++) {
+    T *c_row = c + static_cast<std::ptrdiff_t>(i) * c_stride;
+
+    for (int k = 0; k < depth; k++) {
+      const T a_value = a[static_cast<std::ptrdiff_t>(i) * a_stride + k];
+      const T *b_row = b + static_cast<std::ptrdiff_t>(k) * b_stride;
+
+      for (int j = col_start; j < cols; j++) {
+        c_row[j] += a_value * b_row[j];
+      }
+    }
+  }
+}
+
+#if PXD_SIMD_ENABLED
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// SSE4.2 Kernels
+
+// std::conditional drops the attributes of the vector types, select them with
+// specializations
+template <typename T> struct SSEVector {
+  using type = __m128i;
+};
+template <> struct SSEVector<float> {
+  using type = __m128;
+};
+template <> struct SSEVector<double> {
+  using type = __m128d;
+};
+
+template <typename T> struct SSEArithmetic {
+  using Vec = typename SSEVector<T>::type;
+
+  static constexpr int lanes = 16 / static_cast<int>(sizeof(T));
+
+  PXD_SSE42_TARGET static auto load(const T *values) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm_loadu_ps(values);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm_loadu_pd(values);
+    } else {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i *>(values));
+    }
+  }
+
+  PXD_SSE42_TARGET static void store(T *values, Vec vec) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm_storeu_ps(values, vec);
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm_storeu_pd(values, vec);
+    } else {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(values), vec);
+    }
+  }
+
+  PXD_SSE42_TARGET static auto broadcast(T value) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm_set1_ps(value);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm_set1_pd(value);
+    } else {
+      return _mm_set1_epi32(static_cast<std::int32_t>(value));
+    }
+  }
+
+  PXD_SSE42_TARGET static auto add(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm_add_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm_add_pd(left, right);
+    } else {
+      return _mm_add_epi32(left, right);
+    }
+  }
+
+  PXD_SSE42_TARGET static auto sub(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm_sub_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm_sub_pd(left, right);
+    } else {
+      return _mm_sub_epi32(left, right);
+    }
+  }
+
+  PXD_SSE42_TARGET static auto mul(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm_mul_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm_mul_pd(left, right);
+    } else {
+      // the low 32 bits of the product are the same for the unsigned values
+      return _mm_mullo_epi32(left, right);
+    }
+  }
+};
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// AVX2 Kernels
+
+template <typename T> struct AVX2Vector {
+  using type = __m256i;
+};
+template <> struct AVX2Vector<float> {
+  using type = __m256;
+};
+template <> struct AVX2Vector<double> {
+  using type = __m256d;
+};
+
+template <typename T> struct AVX2Arithmetic {
+  using Vec = typename AVX2Vector<T>::type;
+
+  static constexpr int lanes = 32 / static_cast<int>(sizeof(T));
+
+  PXD_AVX2_TARGET static auto load(const T *values) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_loadu_ps(values);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm256_loadu_pd(values);
+    } else {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+    }
+  }
+
+  PXD_AVX2_TARGET static void store(T *values, Vec vec) noexcept {
+    if constexpr (std::is_same_v<T, float>) {
+      _mm256_storeu_ps(values, vec);
+    } else if constexpr (std::is_same_v<T, double>) {
+      _mm256_storeu_pd(values, vec);
+    } else {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), vec);
+    }
+  }
+
+  PXD_AVX2_TARGET static auto broadcast(T value) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_set1_ps(value);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm256_set1_pd(value);
+    } else {
+      return _mm256_set1_epi32(static_cast<std::int32_t>(value));
+    }
+  }
+
+  PXD_AVX2_TARGET static auto add(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_add_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm256_add_pd(left, right);
+    } else {
+      return _mm256_add_epi32(left, right);
+    }
+  }
+
+  PXD_AVX2_TARGET static auto sub(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_sub_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm256_sub_pd(left, right);
+    } else {
+      return _mm256_sub_epi32(left, right);
+    }
+  }
+
+  PXD_AVX2_TARGET static auto mul(Vec left, Vec right) noexcept -> Vec {
+    if constexpr (std::is_same_v<T, float>) {
+      return _mm256_mul_ps(left, right);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return _mm256_mul_pd(left, right);
+    } else {
+      return _mm256_mullo_epi32(left, right);
+    }
+  }
+};
+
+// the loops are instantiated for each kernel with the kernel's target, so the
+// vector functions are inlined into them. The multiply keeps a 4 row tile of
+// the result in the registers, the tile is one or two vectors wide
+
+#define PXD_MATRIX_DEFINE_KERNEL_LOOPS(PREFIX, KERNEL, TARGET)                 \
+  template <typename T>                                                        \
+  TARGET void PREFIX##_add(const T *left, const T *right, T *out, int size) {  \
+    using Kernel = KERNEL<T>;                                                  \
+    int i = 0;                                                                 \
+                                                                               \
+    for (; i + Kernel::lanes <= size; i += Kernel::lanes) {                    \
+      Kernel::store(out + i, Kernel::add(Kernel::load(left + i),               \
+                                         Kernel::load(right + i)));            \
+    }                                                                          \
+                                                                               \
+    add_scalar(left, right, out, i, size);                                     \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  TARGET void PREFIX##_sub(const T *left, const T *right, T *out, int size) {  \
+    using Kernel = KERNEL<T>;                                                  \
+    int i = 0;                                                                 \
+                                                                               \
+    for (; i + Kernel::lanes <= size; i += Kernel::lanes) {                    \
+      Kernel::store(out + i, Kernel::sub(Kernel::load(left + i),               \
+                                         Kernel::load(right + i)));            \
+    }                                                                          \
+                                                                               \
+    sub_scalar(left, right, out, i, size);                                     \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  TARGET void PREFIX##_scale(const T *values, T scalar, T *out, int size) {    \
+    using Kernel = KERNEL<T>;                                                  \
+    const auto scalar_vec = Kernel::broadcast(scalar);                         \
+    int i = 0;                                                                 \
+                                                                               \
+    for (; i + Kernel::lanes <= size; i += Kernel::lanes) {                    \
+      Kernel::store(out + i,                                                   \
+                    Kernel::mul(Kernel::load(values + i), scalar_vec));        \
+    }                                                                          \
+                                                                               \
+    scale_scalar(values, scalar, out, i, size);                                \
+  }                                                                            \
+                                                                               \
+  template <size_t M, size_t K, size_t N, typename T>                          \
+  TARGET void PREFIX##_multiply(const T *a, const T *b, T *c) {                \
+    using Kernel = KERNEL<T>;                                                  \
+    using Vec = typename Kernel::Vec;                                          \
+    constexpr int lanes = Kernel::lanes;                                       \
+    constexpr int tile_row = 4;                                                \
+    constexpr int tile_vec = static_cast<int>(N) >= lanes * 2 ? 2 : 1;         \
+    constexpr int tile_col = lanes * tile_vec;                                 \
+    constexpr int row_end = static_cast<int>(M) / tile_row * tile_row;         \
+    constexpr int col_end = static_cast<int>(N) / tile_col * tile_col;         \
+                                                                               \
+    for (int i = 0; i < row_end; i += tile_row) {                              \
+      for (int j = 0; j < col_end; j += tile_col) {                            \
+        Vec acc[tile_row][tile_vec];                                           \
+                                                                               \
+        for (int r = 0; r < tile_row; r++) {                                   \
+          for (int v = 0; v < tile_vec; v++) {                                 \
+            acc[r][v] = Kernel::broadcast(T{});                                \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
+        for (int k = 0; k < static_cast<int>(K); k++) {                        \
+          Vec b_vec[tile_vec];                                                 \
+                                                                               \
+          for (int v = 0; v < tile_vec; v++) {                                 \
+            b_vec[v] = Kernel::load(b + k * N + j + v * lanes);                \
+          }                                                                    \
+                                                                               \
+          for (int r = 0; r < tile_row; r++) {                                 \
+            const Vec a_vec = Kernel::broadcast(a[(i + r) * K + k]);           \
+                                                                               \
+            for (int v = 0; v < tile_vec; v++) {                               \
+              const Vec product = Kernel::mul(a_vec, b_vec[v]);                \
+              acc[r][v] = Kernel::add(acc[r][v], product);                     \
+            }                                                                  \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
+        for (int r = 0; r < tile_row; r++) {                                   \
+          for (int v = 0; v < tile_vec; v++) {                                 \
+            Kernel::store(c + (i + r) * N + j + v * lanes, acc[r][v]);         \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    /* the columns and the rows which do not fill a tile */                    \
+    if constexpr (col_end < static_cast<int>(N)) {                             \
+      for (int i = 0; i < row_end; i++) {                                      \
+        for (int j = col_end; j < static_cast<int>(N); j++) {                  \
+          T sum{};                                                             \
+                                                                               \
+          for (int k = 0; k < static_cast<int>(K); k++) {                      \
+            sum += a[i * K + k] * b[k * N + j];                                \
+          }                                                                    \
+                                                                               \
+          c[i * N + j] = sum;                                                  \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    if constexpr (row_end < static_cast<int>(M)) {                             \
+      multiply_scalar<M, K, N>(a, b, c, row_end, 0);                           \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  TARGET void PREFIX##_multiply_add(const T *a, int a_stride, const T *b,      \
+                                    int b_stride, T *c, int c_stride,          \
+                                    int rows, int depth, int cols) {           \
+    using Kernel = KERNEL<T>;                                                  \
+    using Vec = typename Kernel::Vec;                                          \
+    constexpr int lanes = Kernel::lanes;                                       \
+    constexpr int tile_row = 4;                                                \
+    constexpr int tile_col = lanes * 2;                                        \
+    const int row_end = rows / tile_row * tile_row;                            \
+    const int col_end = cols / tile_col * tile_col;                            \
+                                                                               \
+    for (int i = 0; i < row_end; i += tile_row) {                              \
+      const T *a_tile = a + static_cast<std::ptrdiff_t>(i) * a_stride;         \
+      T *c_tile = c + static_cast<std::ptrdiff_t>(i) * c_stride;               \
+                                                                               \
+      for (int j = 0; j < col_end; j += tile_col) {                            \
+        Vec acc[tile_row][2];                                                  \
+                                                                               \
+        for (int r = 0; r < tile_row; r++) {                                   \
+          acc[r][0] = Kernel::load(c_tile + r * c_stride + j);                 \
+          acc[r][1] = Kernel::load(c_tile + r * c_stride + j + lanes);         \
+        }                                                                      \
+                                                                               \
+        const T *b_col = b + j;                                                \
+                                                                               \
+        for (int k = 0; k < depth; k++) {                                      \
+          const T *b_row = b_col + static_cast<std::ptrdiff_t>(k) * b_stride;  \
+          const Vec b_vec_0 = Kernel::load(b_row);                             \
+          const Vec b_vec_1 = Kernel::load(b_row + lanes);                     \
+                                                                               \
+          for (int r = 0; r < tile_row; r++) {                                 \
+            const Vec a_vec = Kernel::broadcast(a_tile[r * a_stride + k]);     \
+            acc[r][0] = Kernel::add(acc[r][0], Kernel::mul(a_vec, b_vec_0));   \
+            acc[r][1] = Kernel::add(acc[r][1], Kernel::mul(a_vec, b_vec_1));   \
+          }                                                                    \
+        }                                                                      \
+                                                                               \
+        for (int r = 0; r < tile_row; r++) {                                   \
+          Kernel::store(c_tile + r * c_stride + j, acc[r][0]);                 \
+          Kernel::store(c_tile + r * c_stride + j + lanes, acc[r][1]);         \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    /* the columns and the rows which do not fill a tile */                    \
+    if (col_end < cols) {                                                      \
+      multiply_add_scalar(a, a_stride, b, b_stride, c, c_stride, row_end,      \
+                          depth, cols, col_end);                               \
+    }                                                                          \
+                                                                               \
+    if (row_end < rows) {                                                      \
+      multiply_add_scalar(a + static_cast<std::ptrdiff_t>(row_end) * a_stride, \
+                          a_stride, b, b_stride,                               \
+                          c + static_cast<std::ptrdiff_t>(row_end) * c_stride, \
+                          c_stride, rows - row_end, depth, cols, 0);           \
+    }                                                                          \
+  }
+
+PXD_MATRIX_DEFINE_KERNEL_LOOPS(sse42, SSEArithmetic, PXD_SSE42_TARGET)
+PXD_MATRIX_DEFINE_KERNEL_LOOPS(avx2, AVX2Arithmetic, PXD_AVX2_TARGET)
+
+#undef PXD_MATRIX_DEFINE_KERNEL_LOOPS
+
+/// @brief transpose a full 4x4 tile of 4 byte values in the registers
+PXD_SSE42_TARGET inline void transpose_tile_4x4(const float *in, int in_stride,
+                                                float *out, int out_stride) {
+  __m128 row_0 = _mm_loadu_ps(in);
+  __m128 row_1 = _mm_loadu_ps(in + in_stride);
+  __m128 row_2 = _mm_loadu_ps(in + in_stride * 2);
+  __m128 row_3 = _mm_loadu_ps(in + in_stride * 3);
+
+  _MM_TRANSPOSE4_PS(row_0, row_1, row_2, row_3);
+
+  _mm_storeu_ps(out, row_0);
+  _mm_storeu_ps(out + out_stride, row_1);
+  _mm_storeu_ps(out + out_stride * 2, row_2);
+  _mm_storeu_ps(out + out_stride * 3, row_3);
+}
+
+#endif
+} // namespace matrix_detail
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// Matrix Kernels
+
+/// @brief out[i] = left[i] + right[i]
+template <typename T>
+void matrix_add(const T *left, const T *right, T *out, int size) {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_arithmetic_v<T>) {
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_avx2()) {
+      matrix_detail::avx2_add(left, right, out, size);
+      return;
+    }
+
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_sse42()) {
+      matrix_detail::sse42_add(left, right, out, size);
+      return;
+    }
+  }
+#endif
+
+  matrix_detail::add_scalar(left, right, out, 0, size);
+}
+
+/// @brief out[i] = left[i] - right[i]
+template <typename T>
+void matrix_sub(const T *left, const T *right, T *out, int size) {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_arithmetic_v<T>) {
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_avx2()) {
+      matrix_detail::avx2_sub(left, right, out, size);
+      return;
+    }
+
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_sse42()) {
+      matrix_detail::sse42_sub(left, right, out, size);
+      return;
+    }
+  }
+#endif
+
+  matrix_detail::sub_scalar(left, right, out, 0, size);
+}
+
+/// @brief out[i] = values[i] * scalar
+template <typename T>
+void matrix_scale(const T *values, T scalar, T *out, int size) {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_arithmetic_v<T>) {
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_avx2()) {
+      matrix_detail::avx2_scale(values, scalar, out, size);
+      return;
+    }
+
+    if (size >= PXD_MATRIX_SIMD_MIN_ELEMENTS && has_sse42()) {
+      matrix_detail::sse42_scale(values, scalar, out, size);
+      return;
+    }
+  }
+#endif
+
+  matrix_detail::scale_scalar(values, scalar, out, 0, size);
+}
+
+/// @brief c = a * b for the row ordered M x K a and K x N b. The dimensions
+/// are compile time constants so the tile loops are unrolled for every size
+/// @param c output, can not be a or b
+template <size_t M, size_t K, size_t N, typename T>
+void matrix_multiply(const T *a, const T *b, T *c) {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_arithmetic_v<T> &&
+                static_cast<int>(M * N) >= PXD_MATRIX_SIMD_MIN_ELEMENTS) {
+    // the narrow matrices do not fill an avx2 vector
+    if (static_cast<int>(N) >= matrix_detail::AVX2Arithmetic<T>::lanes &&
+        has_avx2()) {
+      matrix_detail::avx2_multiply<M, K, N>(a, b, c);
+      return;
+    }
+
+    if (static_cast<int>(N) >= matrix_detail::SSEArithmetic<T>::lanes &&
+        has_sse42()) {
+      matrix_detail::sse42_multiply<M, K, N>(a, b, c);
+      return;
+    }
+  }
+#endif
+
+  matrix_detail::multiply_scalar<M, K, N>(a, b, c, 0, 0);
+}
+
+/// @brief c += a * b for the rows x depth a and the depth x cols b. The
+/// matrices are row ordered with the given strides, the tiles of c are kept in
+/// the registers while the depth is walked. Used on the cache sized blocks of
+/// the bigger matrices
+template <typename T>
+void matrix_multiply_add(const T *a, int a_stride, const T *b, int b_stride,
+                         T *c, int c_stride, int rows, int depth, int cols) {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_arithmetic_v<T>) {
+    if (has_avx2()) {
+      matrix_detail::avx2_multiply_add(a, a_stride, b, b_stride, c, c_stride,
+                                       rows, depth, cols);
+      return;
+    }
+
+    if (has_sse42()) {
+      matrix_detail::sse42_multiply_add(a, a_stride, b, b_stride, c, c_stride,
+                                        rows, depth, cols);
+      return;
+    }
+  }
+#endif
+
+  matrix_detail::multiply_add_scalar(a, a_stride, b, b_stride, c, c_stride,
+                                     rows, depth, cols, 0);
+}
+
+/// @brief out = transpose(in) for the row ordered rows x cols in. The values
+/// are copied block by block so both of the arrays are walked in cache sized
+/// pieces
+/// @param in_stride distance between the rows of in
+/// @param out output, cols x rows, can not be in
+/// @param out_stride distance between the rows of out
+template <typename T>
+void matrix_transpose(const T *in, int in_stride, T *out, int out_stride,
+                      int rows, int cols) {
+  constexpr int block_size = PXD_MATRIX_TRANSPOSE_BLOCK_SIZE;
+
+  for (int row_block = 0; row_block < rows; row_block += block_size) {
+    const int row_end =
+        row_block + block_size < rows ? row_block + block_size : rows;
+
+    for (int col_block = 0; col_block < cols; col_block += block_size) {
+      const int col_end =
+          col_block + block_size < cols ? col_block + block_size : cols;
+
+      int i = row_block;
+
+#if PXD_SIMD_ENABLED
+      if constexpr (sizeof(T) == sizeof(float) &&
+                    std::is_trivially_copyable_v<T>) {
+        if (has_sse42()) {
+          for (; i + 4 <= row_end; i += 4) {
+            int j = col_block;
+
+            for (; j + 4 <= col_end; j += 4) {
+              matrix_detail::transpose_tile_4x4(
+                  reinterpret_cast<const float *>(in + i * in_stride + j),
+                  in_stride,
+                  reinterpret_cast<float *>(out + j * out_stride + i),
+                  out_stride);
+            }
+
+            for (int r = i; r < i + 4; r++) {
+              for (int c = j; c < col_end; c++) {
+                out[c * out_stride + r] = in[r * in_stride + c];
+              }
+            }
+          }
+        }
+      }
+#endif
+
+      for (; i < row_end; i++) {
+        for (int j = col_block; j < col_end; j++) {
+          out[j * out_stride + i] = in[i * in_stride + j];
+        }
+      }
+    }
+  }
+}
+
+/// @brief out = transpose(in) for the packed row ordered rows x cols in
+/// @param out output, cols x rows, can not be in
+template <typename T>
+void matrix_transpose(const T *in, T *out, int rows, int cols) {
+  matrix_transpose(in, cols, out, rows, rows, cols);
+}
+} // namespace pxd
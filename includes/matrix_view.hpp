@@ -0,0 +1,188 @@
+#pragma once
+
+#include "checks.hpp"
+#include "matrix_kernels.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace pxd {
+
+/// @brief non-owning view of a contiguous matrix row. Copying the view copies
+/// the pointer, the values are written through to the matrix
+/// @tparam T value type, const T for the read-only views
+template <typename T> class RowView {
+public:
+  constexpr RowView() noexcept = default;
+  constexpr RowView(T *data, int length) noexcept
+      : data(data), length(length) {}
+
+  constexpr auto operator[](int index) const noexcept -> T & {
+    return data[get_calc_index(index)];
+  }
+
+  /// @brief copy the values of the row to the given array
+  /// @param array array with at least get_length() values
+  void to_array(std::remove_const_t<T> *array) const {
+    for (int i = 0; i < length; i++) {
+      array[i] = data[i];
+    }
+  }
+
+  constexpr auto begin() const noexcept -> T * { return data; }
+  constexpr auto end() const noexcept -> T * { return data + length; }
+
+  constexpr auto get_ptr() const noexcept -> T * { return data; }
+  constexpr auto get_length() const noexcept -> int { return length; }
+  constexpr auto is_empty() const noexcept -> bool { return length == 0; }
+
+private:
+  /// @brief calculate index for negative and positive indices
+  /// @param index the given index
+  /// @return the calculated valid index
+  constexpr auto get_calc_index(int index) const noexcept -> int {
+    PXD_ASSERT(index < length && length + index >= 0);
+
+    return index < 0 ? length + index : index;
+  }
+
+private:
+  T *data = nullptr;
+  int length = 0;
+};
+
+/// @brief non-owning view of a matrix column, the values are stride apart
+/// @tparam T value type, const T for the read-only views
+template <typename T> class ColumnView {
+public:
+  constexpr ColumnView() noexcept = default;
+  constexpr ColumnView(T *data, int length, int stride) noexcept
+      : data(data), length(length), stride(stride) {}
+
+  constexpr auto operator[](int index) const noexcept -> T & {
+    return data[static_cast<std::ptrdiff_t>(get_calc_index(index)) * stride];
+  }
+
+  /// @brief copy the values of the column to the given array
+  /// @param array array with at least get_length() values
+  void to_array(std::remove_const_t<T> *array) const {
+    for (int i = 0; i < length; i++) {
+      array[i] = (*this)[i];
+    }
+  }
+
+  constexpr auto get_ptr() const noexcept -> T * { return data; }
+  constexpr auto get_length() const noexcept -> int { return length; }
+  constexpr auto get_stride() const noexcept -> int { return stride; }
+  constexpr auto is_empty() const noexcept -> bool { return length == 0; }
+
+private:
+  constexpr auto get_calc_index(int index) const noexcept -> int {
+    PXD_ASSERT(index < length && length + index >= 0);
+
+    return index < 0 ? length + index : index;
+  }
+
+private:
+  T *data = nullptr;
+  int length = 0;
+  int stride = 0;
+};
+
+/// @brief non-owning row ordered row x column matrix over external memory,
+/// e.g. a memory mapped buffer. Nothing is copied or freed by the view
+/// @tparam T value type, const T for the read-only views
+template <typename T> class MatrixView {
+public:
+  constexpr MatrixView() noexcept = default;
+  constexpr MatrixView(T *data, int row, int column) noexcept
+      : data(data), row(row), column(column) {}
+  /// @brief read-only view of the same memory
+  template <typename U,
+            typename = std::enable_if_t<std::is_same_v<const U, T> &&
+                                        !std::is_same_v<U, T>>>
+  constexpr MatrixView(const MatrixView<U> &other) noexcept
+      : data(other.get_ptr()), row(other.get_row()),
+        column(other.get_column()) {}
+
+  constexpr auto operator[](int index) const noexcept -> RowView<T> {
+    return get_row_view(index);
+  }
+
+  constexpr auto operator()(int row, int column) const noexcept -> T & {
+    PXD_ASSERT(row < this->row && column < this->column);
+
+    return data[static_cast<std::ptrdiff_t>(row) * this->column + column];
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // View Functions
+
+  constexpr auto get_row_view(int index) const noexcept -> RowView<T> {
+    PXD_ASSERT(index >= 0 && index < row);
+
+    return RowView<T>(data + static_cast<std::ptrdiff_t>(index) * column,
+                      column);
+  }
+
+  constexpr auto get_column_view(int index) const noexcept -> ColumnView<T> {
+    PXD_ASSERT(index >= 0 && index < column);
+
+    return ColumnView<T>(data + index, row, column);
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Arithmetic Functions
+
+  /// @brief add the values of the other view element by element
+  /// @param other view with the same shape
+  void add(const MatrixView<const T> &other) const noexcept {
+    static_assert(!std::is_const_v<T>, "read-only MatrixView");
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    matrix_add(data, other.get_ptr(), data, get_element_count());
+  }
+
+  /// @brief subtract the values of the other view element by element
+  /// @param other view with the same shape
+  void sub(const MatrixView<const T> &other) const noexcept {
+    static_assert(!std::is_const_v<T>, "read-only MatrixView");
+    PXD_ASSERT(row == other.get_row() && column == other.get_column());
+
+    matrix_sub(data, other.get_ptr(), data, get_element_count());
+  }
+
+  /// @brief multiply all the values with the scalar
+  /// @param scalar the multiplier
+  void scale(T scalar) const noexcept {
+    static_assert(!std::is_const_v<T>, "read-only MatrixView");
+    matrix_scale(data, scalar, data, get_element_count());
+  }
+
+  /// @brief write the transpose of the view to the output view
+  /// @param out column x row view, can not overlap with the view
+  void transpose_to(const MatrixView<std::remove_const_t<T>> &out) const {
+    PXD_ASSERT(out.get_row() == column && out.get_column() == row);
+
+    matrix_transpose(data, out.get_ptr(), row, column);
+  }
+
+  // ///////////////////////////////////////////////////////////////////////////////////////////////////
+  // Inline Member Funcs
+
+  constexpr auto get_ptr() const noexcept -> T * { return data; }
+  constexpr auto get_row() const noexcept -> int { return row; }
+  constexpr auto get_column() const noexcept -> int { return column; }
+  constexpr auto get_element_count() const noexcept -> int {
+    return row * column;
+  }
+  constexpr auto get_byte_size() const noexcept -> std::size_t {
+    return static_cast<std::size_t>(get_element_count()) * sizeof(T);
+  }
+
+private:
+  T *data = nullptr;
+  int row = 0;
+  int column = 0;
+};
+} // namespace pxd
@@ -2,9 +2,9 @@
 
 #include "../third-party/re2/re2/re2.h"
 
-namespace pxd {
+#include "string.hpp"
 
-class String;
+namespace pxd {
 
 auto check_regex(const RE2 &regex) -> bool;
 
@@ -21,23 +21,28 @@ inline auto do_it(Func func, Str str, const RE2 &regex) -> bool {
   return func(str, regex, NULL, 0);
 }
 
-template <typename T, typename... A>
-auto full_match(T &full_str, const RE2 &regex, A &&...kwargs) -> bool {
+/// @brief the String, the std::string and the slices are matched in place
+/// with their lengths
+template <typename... A>
+auto full_match(StringView full_str, const RE2 &regex, A &&...kwargs) -> bool {
   if (!check_regex(regex)) {
     return false;
   }
 
-  return do_it(RE2::FullMatchN, full_str.c_str(), regex,
+  return do_it(RE2::FullMatchN, full_str.string_view(), regex,
                RE2::Arg(std::forward<A>(kwargs))...);
 }
 
-template <typename T, typename... A>
-auto partial_match(T &full_str, const RE2 &regex, A &&...kwargs) -> bool {
+/// @brief the String, the std::string and the slices are matched in place
+/// with their lengths
+template <typename... A>
+auto partial_match(StringView full_str, const RE2 &regex,
+                   A &&...kwargs) -> bool {
   if (!check_regex(regex)) {
     return false;
   }
 
-  return do_it(RE2::PartialMatchN, full_str.c_str(), regex,
+  return do_it(RE2::PartialMatchN, full_str.string_view(), regex,
                RE2::Arg(std::forward<A>(kwargs))...);
 }
 
@@ -50,12 +55,9 @@ auto loop_it(T *input, const RE2 &regex, A &&...kwargs) -> bool {
   return do_it(RE2::ConsumeN, input, regex, Arg(std::forward<A>(kwargs))...);
 }
 
-void replace_first(const RE2 &regex, String &base_str, String &new_str);
-void replace_first(const RE2 &regex, String &base_str, String &&new_str);
+void replace_first(const RE2 &regex, String &base_str, StringView new_str);
 
-void replace_all(const RE2 &regex, String &base_str, String &new_str);
-void replace_all(const RE2 &regex, String &base_str, String &&new_str);
+void replace_all(const RE2 &regex, String &base_str, StringView new_str);
 
-auto get_escaped_string(String &base_str) -> String;
-auto get_escaped_string(String &&base_str) -> String;
+auto get_escaped_string(StringView base_str) -> String;
 } // namespace pxd
@@ -0,0 +1,450 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                              \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define PXD_SIMD_ENABLED 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define PXD_SIMD_ENABLED 1
+#else
+#define PXD_SIMD_ENABLED 0
+#endif
+
+// the avx2 kernels are compiled for avx2 even if the project is compiled for
+// sse4.2 and they are only called after the runtime check
+#if defined(__GNUC__) || defined(__clang__)
+#define PXD_AVX2_TARGET __attribute__((target("avx2,popcnt,bmi")))
+#define PXD_SSE42_TARGET __attribute__((target("sse4.2,popcnt")))
+#else
+#define PXD_AVX2_TARGET
+#define PXD_SSE42_TARGET
+#endif
+
+// read prefetch to all the cache levels, a hint which never faults
+#if defined(__GNUC__) || defined(__clang__)
+#define PXD_PREFETCH(address) __builtin_prefetch(address)
+#elif PXD_SIMD_ENABLED
+#define PXD_PREFETCH(address)                                                  \
+  _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0)
+#else
+#define PXD_PREFETCH(address)
+#endif
+
+namespace pxd {
+
+/// @brief check the cpu once and cache the result
+/// @return true if the cpu and the os support the sse4.2 instructions
+auto has_sse42() noexcept -> bool;
+
+/// @brief check the cpu once and cache the result
+/// @return true if the cpu and the os support the avx2 instructions
+auto has_avx2() noexcept -> bool;
+
+/// @brief the types which are compared with the simd kernels, the other types
+/// use the scalar loops
+template <typename T>
+constexpr bool is_simd_searchable_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// @brief bitmap word count which is needed for the find_all of size values
+constexpr auto get_bitmap_word_count(int size) noexcept -> int {
+  return (size + 63) / 64;
+}
+
+namespace simd_detail {
+
+inline auto count_trailing_zeros(std::uint32_t mask) noexcept -> int {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index = 0;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+inline auto popcount(std::uint32_t mask) noexcept -> int {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return static_cast<int>(__popcnt(mask));
+#else
+  return __builtin_popcount(mask);
+#endif
+}
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// Scalar Kernels
+
+template <typename T>
+auto find_scalar(const T *values, int start, int size, const T &value) -> int {
+  for (int i = start; i < size; i++) {
+    if (values[i] == value) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+template <typename T>
+auto count_scalar(const T *values, int start, int size, const T &value)
+    -> int {
+  int match_count = 0;
+
+  for (int i = start; i < size; i++) {
+    match_count += values[i] == value ? 1 : 0;
+  }
+
+  return match_count;
+}
+
+template <typename T>
+auto find_all_scalar(const T *values, int start, int size, const T &value,
+                     std::uint64_t *bitmap) -> int {
+  int match_count = 0;
+
+  for (int i = start; i < size; i++) {
+    if (values[i] == value) {
+      bitmap[i / 64] |= std::uint64_t(1) << (i % 64);
+      match_count++;
+    }
+  }
+
+  return match_count;
+}
+
+#if PXD_SIMD_ENABLED
+
+/// @brief copy the bits of the value to an integer with the same size, the
+/// integer is broadcasted to the all lanes
+template <typename T> auto get_value_bits(const T &value) noexcept {
+  if constexpr (sizeof(T) == 1) {
+    std::int8_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+  } else if constexpr (sizeof(T) == 2) {
+    std::int16_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+  } else if constexpr (sizeof(T) == 4) {
+    std::int32_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+  } else {
+    std::int64_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+  }
+}
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// SSE4.2 Kernels
+
+template <typename T> struct SSEKernel {
+  static constexpr int lanes = 16 / static_cast<int>(sizeof(T));
+
+  PXD_SSE42_TARGET static auto broadcast(const T &value) noexcept -> __m128i {
+    const auto bits = get_value_bits(value);
+
+    if constexpr (sizeof(T) == 1) {
+      return _mm_set1_epi8(bits);
+    } else if constexpr (sizeof(T) == 2) {
+      return _mm_set1_epi16(bits);
+    } else if constexpr (sizeof(T) == 4) {
+      return _mm_set1_epi32(bits);
+    } else {
+      return _mm_set1_epi64x(bits);
+    }
+  }
+
+  /// @brief compare the lanes values with the needle
+  /// @return one bit for every value, the first value is the lowest bit
+  PXD_SSE42_TARGET static auto match(const T *values, __m128i needle) noexcept
+      -> std::uint32_t {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(values));
+
+    if constexpr (std::is_same_v<T, float>) {
+      const __m128 cmp =
+          _mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(needle));
+      return static_cast<std::uint32_t>(_mm_movemask_ps(cmp));
+    } else if constexpr (std::is_same_v<T, double>) {
+      const __m128d cmp =
+          _mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(needle));
+      return static_cast<std::uint32_t>(_mm_movemask_pd(cmp));
+    } else if constexpr (sizeof(T) == 1) {
+      return static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+    } else if constexpr (sizeof(T) == 2) {
+      // narrow the 16 bit results to bytes to get one bit for every value
+      const __m128i cmp = _mm_cmpeq_epi16(block, needle);
+      return static_cast<std::uint32_t>(
+                 _mm_movemask_epi8(_mm_packs_epi16(cmp, cmp))) &
+             0xFFu;
+    } else if constexpr (sizeof(T) == 4) {
+      const __m128i cmp = _mm_cmpeq_epi32(block, needle);
+      return static_cast<std::uint32_t>(
+          _mm_movemask_ps(_mm_castsi128_ps(cmp)));
+    } else {
+      const __m128i cmp = _mm_cmpeq_epi64(block, needle);
+      return static_cast<std::uint32_t>(
+          _mm_movemask_pd(_mm_castsi128_pd(cmp)));
+    }
+  }
+};
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// AVX2 Kernels
+
+template <typename T> struct AVX2Kernel {
+  static constexpr int lanes = 32 / static_cast<int>(sizeof(T));
+
+  PXD_AVX2_TARGET static auto broadcast(const T &value) noexcept -> __m256i {
+    const auto bits = get_value_bits(value);
+
+    if constexpr (sizeof(T) == 1) {
+      return _mm256_set1_epi8(bits);
+    } else if constexpr (sizeof(T) == 2) {
+      return _mm256_set1_epi16(bits);
+    } else if constexpr (sizeof(T) == 4) {
+      return _mm256_set1_epi32(bits);
+    } else {
+      return _mm256_set1_epi64x(bits);
+    }
+  }
+
+  /// @brief compare the lanes values with the needle
+  /// @return one bit for every value, the first value is the lowest bit
+  PXD_AVX2_TARGET static auto match(const T *values, __m256i needle) noexcept
+      -> std::uint32_t {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values));
+
+    if constexpr (std::is_same_v<T, float>) {
+      const __m256 cmp = _mm256_cmp_ps(_mm256_castsi256_ps(block),
+                                       _mm256_castsi256_ps(needle), _CMP_EQ_OQ);
+      return static_cast<std::uint32_t>(_mm256_movemask_ps(cmp));
+    } else if constexpr (std::is_same_v<T, double>) {
+      const __m256d cmp = _mm256_cmp_pd(_mm256_castsi256_pd(block),
+                                        _mm256_castsi256_pd(needle), _CMP_EQ_OQ);
+      return static_cast<std::uint32_t>(_mm256_movemask_pd(cmp));
+    } else if constexpr (sizeof(T) == 1) {
+      return static_cast<std::uint32_t>(
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+    } else if constexpr (sizeof(T) == 2) {
+      // the packing works in 128 bit lanes, the bytes 0-7 and 16-23 are the
+      // results of the values 0-7 and 8-15
+      const __m256i cmp = _mm256_cmpeq_epi16(block, needle);
+      const auto mask = static_cast<std::uint32_t>(
+          _mm256_movemask_epi8(_mm256_packs_epi16(cmp, cmp)));
+      return (mask & 0xFFu) | ((mask >> 8) & 0xFF00u);
+    } else if constexpr (sizeof(T) == 4) {
+      const __m256i cmp = _mm256_cmpeq_epi32(block, needle);
+      return static_cast<std::uint32_t>(
+          _mm256_movemask_ps(_mm256_castsi256_ps(cmp)));
+    } else {
+      const __m256i cmp = _mm256_cmpeq_epi64(block, needle);
+      return static_cast<std::uint32_t>(
+          _mm256_movemask_pd(_mm256_castsi256_pd(cmp)));
+    }
+  }
+};
+
+// the loops are instantiated for each kernel with the kernel's target, so the
+// match calls are inlined into them
+
+#define PXD_SIMD_DEFINE_SEARCH_LOOPS(PREFIX, KERNEL, TARGET)                   \
+  template <typename T>                                                        \
+  TARGET auto PREFIX##_find(const T *values, int size, const T &value)         \
+      -> int {                                                                 \
+    using Kernel = KERNEL<T>;                                                  \
+    constexpr int lanes = Kernel::lanes;                                       \
+    const auto needle = Kernel::broadcast(value);                              \
+    int i = 0;                                                                 \
+                                                                               \
+    for (; i + lanes * 4 <= size; i += lanes * 4) {                            \
+      const std::uint32_t mask_0 = Kernel::match(values + i, needle);          \
+      const std::uint32_t mask_1 = Kernel::match(values + i + lanes, needle);  \
+      const std::uint32_t mask_2 =                                             \
+          Kernel::match(values + i + lanes * 2, needle);                       \
+      const std::uint32_t mask_3 =                                             \
+          Kernel::match(values + i + lanes * 3, needle);                       \
+                                                                               \
+      if ((mask_0 | mask_1 | mask_2 | mask_3) == 0) {                          \
+        continue;                                                              \
+      }                                                                        \
+                                                                               \
+      if (mask_0 != 0) {                                                       \
+        return i + count_trailing_zeros(mask_0);                               \
+      }                                                                        \
+      if (mask_1 != 0) {                                                       \
+        return i + lanes + count_trailing_zeros(mask_1);                       \
+      }                                                                        \
+      if (mask_2 != 0) {                                                       \
+        return i + lanes * 2 + count_trailing_zeros(mask_2);                   \
+      }                                                                        \
+      return i + lanes * 3 + count_trailing_zeros(mask_3);                     \
+    }                                                                          \
+                                                                               \
+    for (; i + lanes <= size; i += lanes) {                                    \
+      const std::uint32_t mask = Kernel::match(values + i, needle);            \
+                                                                               \
+      if (mask != 0) {                                                         \
+        return i + count_trailing_zeros(mask);                                 \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return find_scalar(values, i, size, value);                                \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  TARGET auto PREFIX##_count(const T *values, int size, const T &value)        \
+      -> int {                                                                 \
+    using Kernel = KERNEL<T>;                                                  \
+    constexpr int lanes = Kernel::lanes;                                       \
+    const auto needle = Kernel::broadcast(value);                              \
+    int match_count = 0;                                                       \
+    int i = 0;                                                                 \
+                                                                               \
+    /* the masks of the narrow lane counts share a single popcount */          \
+    constexpr int shift = lanes * 4 <= 32 ? lanes : 0;                         \
+                                                                               \
+    for (; i + lanes * 4 <= size; i += lanes * 4) {                            \
+      const std::uint32_t mask_0 = Kernel::match(values + i, needle);          \
+      const std::uint32_t mask_1 = Kernel::match(values + i + lanes, needle);  \
+      const std::uint32_t mask_2 =                                             \
+          Kernel::match(values + i + lanes * 2, needle);                       \
+      const std::uint32_t mask_3 =                                             \
+          Kernel::match(values + i + lanes * 3, needle);                       \
+                                                                               \
+      if constexpr (shift != 0) {                                              \
+        match_count += popcount(mask_0 | (mask_1 << shift) |                   \
+                                (mask_2 << (shift * 2)) |                      \
+                                (mask_3 << (shift * 3)));                      \
+      } else {                                                                 \
+        match_count += popcount(mask_0) + popcount(mask_1) +                   \
+                       popcount(mask_2) + popcount(mask_3);                    \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    for (; i + lanes <= size; i += lanes) {                                    \
+      match_count += popcount(Kernel::match(values + i, needle));              \
+    }                                                                          \
+                                                                               \
+    return match_count + count_scalar(values, i, size, value);                 \
+  }                                                                            \
+                                                                               \
+  template <typename T>                                                        \
+  TARGET auto PREFIX##_find_all(const T *values, int size, const T &value,     \
+                                std::uint64_t *bitmap) -> int {                \
+    using Kernel = KERNEL<T>;                                                  \
+    constexpr int lanes = Kernel::lanes;                                       \
+    const auto needle = Kernel::broadcast(value);                              \
+    int match_count = 0;                                                       \
+    int i = 0;                                                                 \
+                                                                               \
+    /* the lane count divides 64, a block never crosses a bitmap word */       \
+    for (; i + lanes <= size; i += lanes) {                                    \
+      const std::uint32_t mask = Kernel::match(values + i, needle);            \
+      bitmap[i / 64] |= std::uint64_t(mask) << (i % 64);                       \
+      match_count += popcount(mask);                                           \
+    }                                                                          \
+                                                                               \
+    return match_count + find_all_scalar(values, i, size, value, bitmap);      \
+  }
+
+PXD_SIMD_DEFINE_SEARCH_LOOPS(sse42, SSEKernel, PXD_SSE42_TARGET)
+PXD_SIMD_DEFINE_SEARCH_LOOPS(avx2, AVX2Kernel, PXD_AVX2_TARGET)
+
+#undef PXD_SIMD_DEFINE_SEARCH_LOOPS
+
+#endif
+} // namespace simd_detail
+
+// ///////////////////////////////////////////////////////////////////////////////////////////////////
+// Search Functions
+
+/// @brief get the index of the first value which is equal to the given value.
+/// The arithmetic types are compared with avx2 or sse4.2 based on the cpu
+/// @param values raw array
+/// @param size value count of the array
+/// @param value wanted value
+/// @return index of the value, -1 if there is no equal value
+template <typename T>
+auto simd_find(const T *values, int size, const T &value) -> int {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_searchable_v<T>) {
+    if (has_avx2()) {
+      return simd_detail::avx2_find(values, size, value);
+    }
+
+    if (has_sse42()) {
+      return simd_detail::sse42_find(values, size, value);
+    }
+  }
+#endif
+
+  return simd_detail::find_scalar(values, 0, size, value);
+}
+
+/// @brief count the values which are equal to the given value
+/// @param values raw array
+/// @param size value count of the array
+/// @param value wanted value
+/// @return count of the equal values
+template <typename T>
+auto simd_count(const T *values, int size, const T &value) -> int {
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_searchable_v<T>) {
+    if (has_avx2()) {
+      return simd_detail::avx2_count(values, size, value);
+    }
+
+    if (has_sse42()) {
+      return simd_detail::sse42_count(values, size, value);
+    }
+  }
+#endif
+
+  return simd_detail::count_scalar(values, 0, size, value);
+}
+
+/// @brief mark the values which are equal to the given value
+/// @param values raw array
+/// @param size value count of the array
+/// @param value wanted value
+/// @param bitmap output, get_bitmap_word_count(size) words. The bit i % 64 of
+/// the word i / 64 is set if the value i is equal
+/// @return count of the equal values
+template <typename T>
+auto simd_find_all(const T *values, int size, const T &value,
+                   std::uint64_t *bitmap) -> int {
+  if (size <= 0) {
+    return 0;
+  }
+
+  std::memset(bitmap, 0,
+              sizeof(std::uint64_t) *
+                  static_cast<size_t>(get_bitmap_word_count(size)));
+
+#if PXD_SIMD_ENABLED
+  if constexpr (is_simd_searchable_v<T>) {
+    if (has_avx2()) {
+      return simd_detail::avx2_find_all(values, size, value, bitmap);
+    }
+
+    if (has_sse42()) {
+      return simd_detail::sse42_find_all(values, size, value, bitmap);
+    }
+  }
+#endif
+
+  return simd_detail::find_all_scalar(values, 0, size, value, bitmap);
+}
+} // namespace pxd
@@ -1,41 +1,238 @@
 #pragma once
 
-#ifndef PXD_USE_STD_STRING
-#include "../third-party/SIMDString/SIMDString.h"
-constexpr int PXD_SIMDSTRING_ALIGNMENT = 64;
-#endif
-
 #include "absl/str_cat.hpp"
 #include "absl/str_join.hpp"
+#include "format.h" // fmt/format.h
+#include <algorithm>
 #include <array>
-
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace pxd {
 
+// the chars which are kept in the String object itself, the object with its
+// length, capacity and allocator is a single 64 byte cache line
+constexpr std::size_t PXD_STRING_INLINE_CAPACITY = 39;
+constexpr std::size_t PXD_STRING_ARENA_BLOCK_SIZE = 64 * 1024;
+
+/// @brief allocation hook of the String buffers which do not fit inline
+class IStringAllocator {
+public:
+  virtual ~IStringAllocator() = default;
+
+  /// @param size byte count, the null terminator included
+  virtual auto allocate(std::size_t size) -> char * = 0;
+  virtual void deallocate(char *buffer, std::size_t size) noexcept = 0;
+};
+
+/// @brief monotonic arena of the String buffers. The buffers are bumped out of
+/// the big blocks, deallocate does nothing and release frees all the blocks
+/// at once, so the strings of the arena have to be gone before it
+class StringArena : public IStringAllocator {
+public:
+  StringArena() = default;
+  /// @param block_size byte count of a block, the bigger buffers get their
+  /// own block
+  explicit StringArena(std::size_t block_size) : block_size(block_size) {}
+  StringArena(const StringArena &other) = delete;
+  auto operator=(const StringArena &other) -> StringArena & = delete;
+  StringArena(StringArena &&other) noexcept;
+  auto operator=(StringArena &&other) noexcept -> StringArena &;
+  ~StringArena() noexcept override { release(); }
+
+  auto allocate(std::size_t size) -> char * override;
+  void deallocate(char * /*buffer*/, std::size_t /*size*/) noexcept override {}
+
+  /// @brief free all the blocks
+  void release() noexcept;
+
+  /// @brief reuse the blocks from the start, the big buffers are freed. The
+  /// blocks are not given back to the os, so the next strings do not fault
+  /// the pages in again
+  void reset() noexcept;
+
+  /// @brief the byte count which is given to the strings
+  auto get_used_size() const noexcept -> std::size_t { return used_size; }
+
+private:
+  void exec_move() noexcept;
+
+private:
+  std::vector<char *> blocks;
+  // the buffers which are bigger than a quarter block
+  std::vector<char *> big_blocks;
+  std::size_t block_index = 0;
+  char *current = nullptr;
+  std::size_t remaining_size = 0;
+  std::size_t used_size = 0;
+  std::size_t block_size = PXD_STRING_ARENA_BLOCK_SIZE;
+};
+
+class String;
+class StringSplit;
+
+/// @brief non-owning view of chars which keeps their length. A String, a
+/// std::string or a slice of them is passed without a copy and without
+/// measuring it again. The chars have to outlive the view and they are not
+/// null terminated in general, so there is no c_str
+class StringView {
+public:
+  static constexpr std::size_t npos = std::string_view::npos;
+
+  constexpr StringView() noexcept = default;
+  constexpr StringView(const char *chars, std::size_t chars_length) noexcept
+      : chars(chars), view_length(chars_length) {}
+  constexpr StringView(const char *c_str) noexcept
+      : chars(c_str), view_length(std::char_traits<char>::length(c_str)) {}
+  constexpr StringView(std::string_view view) noexcept
+      : chars(view.data()), view_length(view.length()) {}
+  StringView(const std::string &str) noexcept
+      : chars(str.data()), view_length(str.length()) {}
+  StringView(const String &str) noexcept;
+
+  constexpr auto operator[](std::size_t index) const noexcept -> const char & {
+    return chars[index];
+  }
+
+  constexpr auto data() const noexcept -> const char * { return chars; }
+  constexpr auto length() const noexcept -> std::size_t { return view_length; }
+  constexpr auto is_empty() const noexcept -> bool { return view_length == 0; }
+
+  constexpr auto begin() const noexcept -> const char * { return chars; }
+  constexpr auto end() const noexcept -> const char * {
+    return chars + view_length;
+  }
+
+  /// @brief view of count chars from the index, clamped to the end
+  constexpr auto substr(std::size_t index,
+                        std::size_t count = npos) const noexcept
+      -> StringView {
+    index = index < view_length ? index : view_length;
+    const std::size_t rest = view_length - index;
+
+    return {chars + index, count < rest ? count : rest};
+  }
+
+  constexpr auto starts_with(StringView prefix) const noexcept -> bool {
+    return string_view().starts_with(prefix.string_view());
+  }
+
+  constexpr auto ends_with(StringView suffix) const noexcept -> bool {
+    return string_view().ends_with(suffix.string_view());
+  }
+
+  // the searches compare 16 or 32 chars at once with sse4.2 or avx2 based on
+  // the cpu, they never allocate
+
+  /// @return index of the first byte from the index, npos if there is none
+  auto find(char byte, std::size_t index = 0) const noexcept -> std::size_t;
+
+  /// @return index of the first needle from the index, npos if there is none
+  auto find(StringView needle, std::size_t index = 0) const noexcept
+      -> std::size_t;
+
+  /// @return index of the last byte which starts at or before the index, npos
+  /// if there is none
+  auto rfind(char byte, std::size_t index = npos) const noexcept
+      -> std::size_t;
+
+  /// @return index of the last needle which starts at or before the index,
+  /// npos if there is none
+  auto rfind(StringView needle, std::size_t index = npos) const noexcept
+      -> std::size_t;
+
+  auto count(char byte) const noexcept -> std::size_t;
+
+  /// @brief count of the needles which do not overlap
+  auto count(StringView needle) const noexcept -> std::size_t;
+
+  /// @brief lazy split on the delimiter, see StringSplit
+  auto split(char delimiter) const noexcept -> StringSplit;
+  auto split(StringView delimiter) const noexcept -> StringSplit;
+
+  constexpr auto string_view() const noexcept -> std::string_view {
+    return {chars, view_length};
+  }
+
+  /// @brief copy of the chars, the only allocating conversion
+  auto string() const -> std::string { return {chars, view_length}; }
+
+  constexpr operator std::string_view() const noexcept {
+    return string_view();
+  }
+
+  template <typename H> friend H AbslHashValue(H hasher, StringView view) {
+    return H::combine(std::move(hasher), view.string_view());
+  }
+
+private:
+  const char *chars = "";
+  std::size_t view_length = 0;
+};
+
+constexpr auto operator==(StringView self, StringView other) noexcept -> bool {
+  return self.string_view() == other.string_view();
+}
+
+constexpr auto operator!=(StringView self, StringView other) noexcept -> bool {
+  return self.string_view() != other.string_view();
+}
+
+/// @brief (needle, replacement) pairs of the multi pattern replace
+using StringReplacements = std::vector<std::pair<StringView, StringView>>;
+
+/// @brief string which keeps its length, so the copies and the comparisons
+/// never measure it again. Up to PXD_STRING_INLINE_CAPACITY chars are kept
+/// inline without an allocation, the longer ones are on the heap or on the
+/// given allocator. The copies and the concatenations use the heap, a moved
+/// string keeps the allocator of its buffer. With PXD_USE_STD_STRING the value
+/// is a std::string, its small string optimization keeps the short values
+/// inline and the allocator is not used
 class String {
 public:
-  String() = default;
+#ifdef PXD_USE_STD_STRING
+  String() noexcept = default;
+#else
+  String() noexcept { inline_buffer[0] = '\0'; }
+#endif
   String(const std::string &str);
   String(const char *c_str);
-  String(const String &other) = default;
-
+  String(const char *chars, std::size_t chars_length,
+         IStringAllocator *allocator = nullptr);
+  /// @brief empty string which allocates from the given allocator
+  explicit String(IStringAllocator *allocator) noexcept
+      : allocator(allocator) {
 #ifndef PXD_USE_STD_STRING
-  String(const SIMDString<PXD_SIMDSTRING_ALIGNMENT> &other);
+    inline_buffer[0] = '\0';
 #endif
+  }
+  /// @brief copy of the viewed chars, explicit since it allocates
+  explicit String(StringView view, IStringAllocator *allocator = nullptr)
+      : String(view.data(), view.length(), allocator) {}
+  String(const String &other);
 
   auto operator=(const String &other) -> String &;
   auto operator=(const std::string &other) -> String &;
-  String(String &&other) noexcept = default;
+  String(String &&other) noexcept;
 
   auto operator=(String &&other) noexcept -> String &;
   auto operator=(std::string &&other) noexcept -> String &;
   auto operator=(const char *other) -> String &;
 
-  ~String() = default;
+  ~String() noexcept { release(); }
 
-  decltype(auto) operator[](int index) { return value[index]; }
-  decltype(auto) get_value() const { return value; }
+  auto operator[](int index) -> char & { return data()[index]; }
+  auto operator[](int index) const -> const char & { return data()[index]; }
+  auto get_value() const noexcept -> std::string_view { return string_view(); }
 
   auto operator+(const String &other) -> String;
   auto operator+(String &&other) -> String;
@@ -59,60 +256,64 @@ public:
   auto operator-=(const std::string &other) -> String &;
   auto operator-=(const char *other) -> String &;
 
-  auto operator==(const char *c_str) -> bool { return compare_cstr(c_str); }
-  auto operator==(String &other) -> bool { return value == other.get_value(); }
+  auto operator==(const char *c_str) -> bool {
+    return string_view() == c_str;
+  }
+  auto operator==(String &other) -> bool {
+    return string_view() == other.string_view();
+  }
   auto operator==(String &&other) -> bool {
-    return value == std::forward<String>(other).get_value();
+    return string_view() == other.string_view();
   }
-  auto operator==(const std::string &str) -> bool { return compare_str(str); }
-  auto operator==(std::string &&str) -> bool {
-    return compare_str(std::forward<std::string>(str));
+  auto operator==(const std::string &str) -> bool {
+    return string_view() == str;
   }
+  auto operator==(std::string &&str) -> bool { return string_view() == str; }
 
-  auto operator!=(const char *c_str) -> bool { return !compare_cstr(c_str); }
-  auto operator!=(String &other) -> bool { return value != other.get_value(); }
+  auto operator!=(const char *c_str) -> bool {
+    return string_view() != c_str;
+  }
+  auto operator!=(String &other) -> bool {
+    return string_view() != other.string_view();
+  }
   auto operator!=(String &&other) -> bool {
-    return value != std::forward<String>(other).get_value();
+    return string_view() != other.string_view();
   }
-  auto operator!=(const std::string &str) -> bool { return !compare_str(str); }
-  auto operator!=(std::string &&str) -> bool {
-    return !compare_str(std::forward<std::string>(str));
+  auto operator!=(const std::string &str) -> bool {
+    return string_view() != str;
   }
+  auto operator!=(std::string &&str) -> bool { return string_view() != str; }
 
   /// @brief return as std::string
-  operator std::string() { return string(); }
+  operator std::string() const { return string(); }
 
   /// @brief return as std::string_view
-  operator std::string_view() { return std::string_view(c_str()); }
+  operator std::string_view() const noexcept { return string_view(); }
 
   /// @brief return as const char*
-  operator const char *() { return c_str(); }
+  operator const char *() const noexcept { return c_str(); }
 
   // -----------------------------------------------------------------------------
   // -- Constant Strings
 
-  static decltype(auto) get_punctuation() {
-    return std::forward<String>(String("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~"));
+  static auto get_punctuation() -> String {
+    return String("!\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~");
   }
 
-  static decltype(auto) get_digits() {
-    return std::forward<String>(String("0123456789"));
-  }
+  static auto get_digits() -> String { return String("0123456789"); }
 
-  static decltype(auto) get_hex_digits() {
-    return std::forward<String>(String("0123456789abcdefABCDEF"));
+  static auto get_hex_digits() -> String {
+    return String("0123456789abcdefABCDEF");
   }
 
-  static decltype(auto) get_oct_digits() {
-    return std::forward<String>(String("01234567"));
-  }
+  static auto get_oct_digits() -> String { return String("01234567"); }
 
-  static decltype(auto) get_ascii_lowers() {
-    return std::forward<String>(String("abcdefghijklmnopqrstuvwxyz"));
+  static auto get_ascii_lowers() -> String {
+    return String("abcdefghijklmnopqrstuvwxyz");
   }
 
-  static decltype(auto) get_ascii_uppers() {
-    return std::forward<String>(String("ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+  static auto get_ascii_uppers() -> String {
+    return String("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
   }
 
   /// @brief get string which value is in the center and surrounded by the
@@ -124,23 +325,56 @@ public:
 
   /// @brief get std::string of the value
   /// @return std::string of the value
-  auto string() const -> std::string {
-#ifdef PXD_USE_STD_STRING
-    return value;
-#else
-    return std::string(value.c_str());
-#endif
-  }
+  auto string() const -> std::string { return std::string(data(), length()); }
 
   /// @brief get string_view of the value
   /// @return string_view of the value
-  auto string_view() const -> std::string_view {
-    return std::string_view(value.c_str());
+  auto string_view() const noexcept -> std::string_view {
+    return std::string_view(data(), length());
   }
 
   /// @brief get the const char* of the value
   /// @return const char* representation of the value
-  auto c_str() const -> const char * { return value.c_str(); }
+  auto c_str() const noexcept -> const char * { return data(); }
+
+  auto data() noexcept -> char * {
+#ifdef PXD_USE_STD_STRING
+    return value.data();
+#else
+    return is_inline() ? inline_buffer : heap_buffer;
+#endif
+  }
+  auto data() const noexcept -> const char * {
+#ifdef PXD_USE_STD_STRING
+    return value.data();
+#else
+    return is_inline() ? inline_buffer : heap_buffer;
+#endif
+  }
+
+  /// @brief replace the value with the given chars, the buffer is reused if
+  /// they fit
+  auto assign(const char *chars, std::size_t chars_length) -> String &;
+
+  /// @brief append the given chars, the buffer grows at least twice
+  auto append(const char *chars, std::size_t chars_length) -> String &;
+
+  auto append(StringView view) -> String & {
+    return append(view.data(), view.length());
+  }
+
+  /// @brief make the buffer big enough for the given length
+  void reserve(std::size_t new_capacity);
+
+  /// @brief make the value empty, the buffer is kept
+  void clear() noexcept {
+#ifdef PXD_USE_STD_STRING
+    value.clear();
+#else
+    value_length = 0;
+    data()[0] = '\0';
+#endif
+  }
 
   /// @brief replace the first occurence of the old_val with the new_val
   /// @param old_val wanted to be replaced
@@ -152,39 +386,317 @@ public:
   /// @param new_val wanted to be replaced with
   auto replace_all(const char *old_val, const char *new_val) -> String &;
 
-  /// @brief get the length of the value
-  /// @return length of the value
-  auto length() const -> size_t { return value.length(); }
+  auto find(char byte, std::size_t index = 0) const noexcept -> std::size_t {
+    return StringView(*this).find(byte, index);
+  }
 
-  template <typename H> friend H AbslHashValue(H hasher, const String &str) {
-    return H::combine(std::move(hasher), str.string());
+  auto find(StringView needle, std::size_t index = 0) const noexcept
+      -> std::size_t {
+    return StringView(*this).find(needle, index);
   }
 
-private:
-  auto compare_str(const std::string &str) -> bool {
-    return value.compare(str) == 0;
+  auto rfind(char byte, std::size_t index = StringView::npos) const noexcept
+      -> std::size_t {
+    return StringView(*this).rfind(byte, index);
   }
 
-  auto compare_str(std::string &&str) -> bool {
-    return value.compare(std::forward<std::string>(str)) == 0;
+  auto rfind(StringView needle,
+             std::size_t index = StringView::npos) const noexcept
+      -> std::size_t {
+    return StringView(*this).rfind(needle, index);
   }
 
-  auto compare_cstr(const char *cstr) -> bool {
+  auto count(char byte) const noexcept -> std::size_t {
+    return StringView(*this).count(byte);
+  }
+
+  auto count(StringView needle) const noexcept -> std::size_t {
+    return StringView(*this).count(needle);
+  }
+
+  /// @brief lazy split on the delimiter, the tokens are views of the value,
+  /// so the string has to outlive them
+  auto split(char delimiter) const noexcept -> StringSplit;
+  auto split(StringView delimiter) const noexcept -> StringSplit;
+
+  /// @brief replace all the needles of the pairs in a single pass, see
+  /// StringReplacer for the order of the overlapping needles. The automaton is
+  /// built on every call, a StringReplacer is kept for the repeated pairs
+  auto replace_many(const StringReplacements &replacements) -> String &;
+
+  /// @brief write the value with the replaced needles to the output, its
+  /// buffer is reused if it is big enough
+  /// @return count of the replaced needles
+  auto replace_many(const StringReplacements &replacements,
+                    String &output) const -> std::size_t;
+
+  /// @brief get the length of the value
+  /// @return length of the value
 #ifdef PXD_USE_STD_STRING
-    return value.compare(std::string(cstr)) == 0;
+  auto length() const noexcept -> size_t { return value.length(); }
+  auto capacity() const noexcept -> size_t { return value.capacity(); }
+  auto is_empty() const noexcept -> bool { return value.empty(); }
+
+  /// @brief true if the value is in the object without an allocation
+  auto is_inline() const noexcept -> bool {
+    const auto *object = reinterpret_cast<const char *>(&value);
+
+    return value.data() >= object && value.data() < object + sizeof(value);
+  }
 #else
-    return value.compare(cstr) == 0;
+  auto length() const noexcept -> size_t { return value_length; }
+  auto capacity() const noexcept -> size_t { return buffer_capacity; }
+  auto is_empty() const noexcept -> bool { return value_length == 0; }
+
+  /// @brief true if the value is in the object without an allocation
+  auto is_inline() const noexcept -> bool {
+    return buffer_capacity == PXD_STRING_INLINE_CAPACITY;
+  }
 #endif
+
+  auto get_allocator() const noexcept -> IStringAllocator * {
+    return allocator;
+  }
+
+  template <typename H> friend H AbslHashValue(H hasher, const String &str) {
+    return H::combine(std::move(hasher), str.string_view());
   }
 
+  /// @brief the left and the right values in a string of the exact length
+  static auto concat(std::string_view left, std::string_view right) -> String;
+
+private:
+#ifndef PXD_USE_STD_STRING
+  auto allocate_buffer(std::size_t new_capacity) -> char *;
+#endif
+  void release() noexcept;
+  void exec_move() noexcept;
+
 private:
 #ifdef PXD_USE_STD_STRING
   std::string value = {};
+  IStringAllocator *allocator = nullptr;
 #else
-  SIMDString<PXD_SIMDSTRING_ALIGNMENT> value = {};
+  std::size_t value_length = 0;
+  std::size_t buffer_capacity = PXD_STRING_INLINE_CAPACITY;
+  IStringAllocator *allocator = nullptr;
+
+  // only the chars up to the null terminator are initialized
+  union {
+    char *heap_buffer;
+    char inline_buffer[PXD_STRING_INLINE_CAPACITY + 1];
+  };
 #endif
 };
 
+inline StringView::StringView(const String &str) noexcept
+    : chars(str.data()), view_length(str.length()) {}
+
+/// @brief lazy split of a view on a delimiter, the tokens are views of the
+/// input and nothing is allocated. The empty tokens are kept like in the
+/// absl::StrSplit, an empty input is a single empty token and an empty
+/// delimiter does not split. A single byte delimiter is found with a bitmap of
+/// the next 64 chars, so a token costs a few bit operations
+class StringSplit {
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = StringView;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const StringView *;
+    using reference = const StringView &;
+
+    /// @brief the end iterator
+    Iterator() = default;
+
+    auto operator*() const noexcept -> reference { return token; }
+    auto operator->() const noexcept -> pointer { return &token; }
+
+    auto operator++() noexcept -> Iterator & {
+      advance();
+      return *this;
+    }
+
+    auto operator++(int) noexcept -> Iterator {
+      Iterator old = *this;
+      advance();
+      return old;
+    }
+
+    friend auto operator==(const Iterator &self,
+                           const Iterator &other) noexcept -> bool {
+      return self.is_end == other.is_end &&
+             (self.is_end || self.token.data() == other.token.data());
+    }
+
+    friend auto operator!=(const Iterator &self,
+                           const Iterator &other) noexcept -> bool {
+      return !(self == other);
+    }
+
+  private:
+    friend class StringSplit;
+
+    Iterator(const StringSplit &split) noexcept;
+
+    void advance() noexcept;
+
+    /// @return index of the next delimiter, npos if there is none
+    auto find_delimiter() noexcept -> std::size_t;
+
+  private:
+    StringView input;
+    const char *delimiter_chars = nullptr;
+    std::size_t delimiter_length = 0;
+    char delimiter_byte = '\0';
+    StringView token;
+    std::size_t next_index = 0;
+    std::size_t block_index = 0;
+    // the delimiters of the block which are not passed yet
+    std::uint64_t block_mask = 0;
+    bool is_last = false;
+    bool is_end = true;
+  };
+
+  /// @param delimiter the chars have to outlive the split and its iterators
+  /// if it is longer than a byte
+  StringSplit(StringView input, StringView delimiter) noexcept
+      : input(input), delimiter_chars(delimiter.data()),
+        delimiter_length(delimiter.length()),
+        delimiter_byte(delimiter.is_empty() ? '\0' : delimiter[0]) {}
+  StringSplit(StringView input, char delimiter) noexcept
+      : input(input), delimiter_length(1), delimiter_byte(delimiter) {}
+
+  auto begin() const noexcept -> Iterator { return Iterator(*this); }
+  auto end() const noexcept -> Iterator { return {}; }
+
+  /// @brief bitmap of the count chars, at most 64, the bit i is set if the
+  /// char i is the byte
+  static auto match_block(const char *chars, std::size_t count,
+                          char byte) noexcept -> std::uint64_t;
+
+private:
+  StringView input;
+  // a single byte delimiter is kept by value
+  const char *delimiter_chars = nullptr;
+  std::size_t delimiter_length = 0;
+  char delimiter_byte = '\0';
+};
+
+inline StringSplit::Iterator::Iterator(const StringSplit &split) noexcept
+    : input(split.input), delimiter_chars(split.delimiter_chars),
+      delimiter_length(split.delimiter_length),
+      delimiter_byte(split.delimiter_byte), is_end(false) {
+  if (delimiter_length == 1 && !input.is_empty()) {
+    block_mask =
+        match_block(input.data(), std::min<std::size_t>(input.length(), 64),
+                    delimiter_byte);
+  }
+
+  advance();
+}
+
+inline void StringSplit::Iterator::advance() noexcept {
+  if (is_last) {
+    is_end = true;
+    token = StringView();
+    return;
+  }
+
+  const std::size_t index = find_delimiter();
+
+  if (index == StringView::npos) {
+    token = input.substr(next_index);
+    is_last = true;
+    return;
+  }
+
+  token = StringView(input.data() + next_index, index - next_index);
+  next_index = index + delimiter_length;
+}
+
+inline auto StringSplit::Iterator::find_delimiter() noexcept -> std::size_t {
+  if (delimiter_length != 1) {
+    return delimiter_length == 0
+               ? StringView::npos
+               : input.find(StringView(delimiter_chars, delimiter_length),
+                            next_index);
+  }
+
+  // the delimiters are taken from the bitmap, the next 64 chars are matched
+  // only when it is empty
+  while (block_mask == 0) {
+    block_index += 64;
+
+    if (block_index >= input.length()) {
+      return StringView::npos;
+    }
+
+    block_mask = match_block(
+        input.data() + block_index,
+        std::min<std::size_t>(input.length() - block_index, 64),
+        delimiter_byte);
+  }
+
+  const std::size_t index = block_index + std::countr_zero(block_mask);
+  block_mask &= block_mask - 1;
+
+  return index;
+}
+
+/// @brief Aho-Corasick automaton of the (needle, replacement) pairs, it is
+/// built once and finds all the needles in a single pass over the input. The
+/// matches do not overlap and are the leftmost longest ones, like the ones of
+/// absl::StrReplaceAll: the needle which starts first is replaced, among the
+/// needles which start at the same char the longest one wins, and the search
+/// starts again after it. The empty needles are ignored, the first pair of a
+/// repeated needle is used
+class StringReplacer {
+public:
+  StringReplacer() = default;
+  explicit StringReplacer(const StringReplacements &replacements);
+
+  /// @brief write the input with the replaced needles to the output. The
+  /// output length is known before the writes, so the output buffer grows at
+  /// most once and a big enough one is reused. The input must not be a view
+  /// of the output
+  /// @return count of the replaced needles
+  auto replace(StringView input, String &output) -> std::size_t;
+
+  auto get_needle_count() const noexcept -> std::size_t {
+    return needle_lengths.size();
+  }
+
+private:
+  struct Match {
+    std::size_t position;
+    int index;
+  };
+
+  /// @brief fill the matches of the input
+  /// @return length of the replaced input
+  auto find_matches(StringView input) -> std::size_t;
+
+private:
+  std::vector<String> replacements;
+  std::vector<std::size_t> needle_lengths;
+  // the bytes of the needles have their own classes, the rest share class 0,
+  // so a state has class_count transitions instead of 256
+  std::array<std::uint16_t, 256> byte_classes{};
+  std::size_t class_count = 1;
+  // the transition of row + byte class is the row of the next state, the rows
+  // are premultiplied by class_count. The transitions to a state where a
+  // needle ends are ~row, so the search branches only on those
+  std::vector<int> transitions = std::vector<int>(1, 0);
+  // index of the longest needle which ends at the state, -1 if none, and the
+  // length of the trie path of the state, by state number
+  std::vector<int> state_outputs = std::vector<int>(1, -1);
+  std::vector<std::size_t> state_depths = std::vector<std::size_t>(1, 0);
+  // kept between the calls, the replace does not allocate for them
+  std::vector<Match> matches;
+};
+
 auto operator+(const String &self, const String &other) -> String;
 auto operator+(const String &self, String &&other) -> String;
 auto operator+(const String &self, const std::string &other) -> String;
@@ -203,9 +715,122 @@ auto operator!=(const String &self, const std::string &other) -> bool;
 auto operator!=(const String &self, std::string &&other) -> bool;
 auto operator!=(const String &self, const char *other) -> bool;
 
+/// @brief a part of the concatenations like the absl::AlphaNum, the strings
+/// are viewed and the numbers are formatted with fmt into the part itself, so
+/// the total length is known before the single allocation
+class StringPart {
+public:
+  template <typename T> StringPart(const T &value) {
+    if constexpr (std::is_same_v<T, char>) {
+      digits[0] = value;
+      view = StringView(digits.data(), 1);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      static_assert(!std::is_same_v<T, bool> &&
+                        !std::is_same_v<T, long double>,
+                    "the bools and the long doubles are not formatted");
+
+      const char *end = nullptr;
+
+      if constexpr (std::is_integral_v<T>) {
+        // the integers skip the parsing of the format string
+        const fmt::format_int formatted(value);
+        end = std::copy_n(formatted.data(), formatted.size(), digits.data());
+      } else {
+        end = fmt::format_to(digits.data(), "{}", value);
+      }
+
+      view = StringView(digits.data(), end - digits.data());
+    } else {
+      view = StringView(value);
+    }
+  }
+
+  /// @brief the absl::Hex and the absl::Dec, they are formatted by absl
+  StringPart(absl::Hex hex) { copy_digits(absl::AlphaNum(hex)); }
+  StringPart(absl::Dec dec) { copy_digits(absl::AlphaNum(dec)); }
+
+  // the view may point to the digits of the part
+  StringPart(const StringPart &other) = delete;
+  auto operator=(const StringPart &other) -> StringPart & = delete;
+
+  auto get_view() const noexcept -> StringView { return view; }
+
+private:
+  void copy_digits(const absl::AlphaNum &alpha_num) noexcept {
+    memcpy(digits.data(), alpha_num.data(), alpha_num.size());
+    view = StringView(digits.data(), alpha_num.size());
+  }
+
+private:
+  StringView view;
+  // the shortest double or a 64 bit integer fit
+  std::array<char, 32> digits;
+};
+
+/// @brief reusable buffer of the composite strings. The parts of an append are
+/// measured before they are copied, so the buffer grows at most once for them
+/// and it is not allocated again after a clear. The strings up to 500 chars
+/// are kept in the builder itself
+class StringBuilder {
+public:
+  StringBuilder() = default;
+
+  template <typename... Args>
+  auto append(const Args &...args) -> StringBuilder & {
+    return append_parts({StringPart(args)...});
+  }
+
+  /// @brief append the formatted args, the format string is checked at
+  /// compile time
+  template <typename... Args>
+  auto append_format(fmt::format_string<Args...> format_str, Args &&...args)
+      -> StringBuilder & {
+    fmt::format_to(std::back_inserter(buffer), format_str,
+                   std::forward<Args>(args)...);
+    return *this;
+  }
+
+  /// @brief view of the built chars, valid until the next change
+  auto view() const noexcept -> StringView {
+    return StringView(buffer.data(), buffer.size());
+  }
+
+  auto length() const noexcept -> std::size_t { return buffer.size(); }
+
+  /// @brief copy of the built chars in a String of the exact length
+  auto build(IStringAllocator *allocator = nullptr) const -> String {
+    return String(view(), allocator);
+  }
+
+  /// @brief make it empty, the buffer is kept
+  void clear() noexcept { buffer.clear(); }
+
+private:
+  auto append_parts(std::initializer_list<StringPart> parts) -> StringBuilder &;
+
+private:
+  fmt::memory_buffer buffer;
+};
+
 namespace str {
 auto to_string(const char *char_arr) -> String;
 
+/// @brief the parts of a concat, see StringPart
+auto concat_parts(std::initializer_list<StringPart> parts) -> String;
+void append_parts(String &dest, std::initializer_list<StringPart> parts);
+
+/// @brief concatenate the strings and the numbers like the absl::StrCat, the
+/// result is allocated once with the exact length
+template <typename... Args> auto concat(const Args &...args) -> String {
+  return concat_parts({StringPart(args)...});
+}
+
+/// @brief append the strings and the numbers like the absl::StrAppend, the
+/// dest grows at most once. The args must not be views of the dest
+template <typename... Args> void append(String &dest, const Args &...args) {
+  append_parts(dest, {StringPart(args)...});
+}
+
 template <typename... Str>
 static auto join(const char *seperator, const Str &...given_values) -> String {
   const size_t given_values_count = sizeof...(given_values);
@@ -216,4 +841,4 @@ static auto join(const char *seperator, const Str &...given_values) -> String {
 
 } // namespace str
 
-} // namespace pxd
\ No newline at end of file
+} // namespace pxd
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+
+/// @brief fixed size pool of worker threads for the data parallel loops. The
+/// calling thread works on the tasks too, so a pool of n threads starts n - 1
+/// workers
+class ThreadPool {
+public:
+  /// @param thread_count thread count including the calling thread, the
+  /// hardware thread count if it is not positive
+  explicit ThreadPool(int thread_count = 0);
+  ThreadPool(const ThreadPool &other) = delete;
+  auto operator=(const ThreadPool &other) -> ThreadPool & = delete;
+  ~ThreadPool() noexcept;
+
+  /// @brief run task(0) ... task(task_count - 1) on the pool and wait for all
+  /// of them. Can not be called from a task of the same pool
+  /// @param task_count task count
+  /// @param task the task, called concurrently with the different indices
+  void parallel_for(int task_count, const std::function<void(int)> &task);
+
+  auto get_thread_count() const noexcept -> int {
+    return static_cast<int>(workers.size()) + 1;
+  }
+
+  /// @brief the pool which is shared by the library, started on the first use
+  /// with the hardware thread count
+  static auto get_default() -> ThreadPool &;
+
+private:
+  void work_loop();
+  void run_tasks();
+
+private:
+  std::vector<std::thread> workers;
+
+  // only one parallel_for runs at a time
+  std::mutex run_mutex;
+
+  std::mutex mutex;
+  std::condition_variable start_condition;
+  std::condition_variable done_condition;
+  const std::function<void(int)> *current_task = nullptr;
+  int task_count = 0;
+  std::atomic<int> next_task{0};
+  int running_worker_count = 0;
+  std::uint64_t generation = 0;
+  bool b_stop = false;
+};
+} // namespace pxd
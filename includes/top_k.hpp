@@ -0,0 +1,235 @@
+#pragma once
+
+#include "checks.hpp"
+#include "ds/dheap.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace pxd {
+
+// smaller inputs are not split, the threads cost more than the scan
+constexpr int PXD_TOP_K_PARALLEL_MIN_SIZE = 1 << 16;
+// tasks per pool thread, the smaller chunks balance the uneven threads
+constexpr int PXD_TOP_K_TASKS_PER_THREAD = 4;
+
+enum class eTOP_K_ALGORITHM : std::uint8_t {
+  HEAP = 0,  // streaming min heap of k values, O(n log k), keeps the input
+  SELECT = 1 // nth_element on a copy of the input, O(n)
+};
+
+/// @brief streaming accumulator of the k biggest values. The values can be
+/// pushed chunk by chunk and the accumulators of the different threads can be
+/// merged. The heap is allocated once in the constructor, the pushes and the
+/// reset do not allocate
+/// @tparam T value type, compared with < and >
+/// @tparam D children count of the heap nodes
+template <typename T, int D = 4> class TopK {
+public:
+  explicit TopK(int k) : k(k > 0 ? k : 0), heap(k > 0 ? k : 0) {}
+  TopK(const TopK &other) = default;
+  auto operator=(const TopK &other) -> TopK & = default;
+  TopK(TopK &&other) noexcept = default;
+  auto operator=(TopK &&other) noexcept -> TopK & = default;
+  ~TopK() noexcept = default;
+
+  /// @brief forget the values, the heap keeps its memory
+  void reset() noexcept { heap.release(); }
+
+  /// @brief offer the value, it is kept if it is bigger than the smallest
+  /// kept value
+  /// @param value the value
+  void push(const T &value) {
+    if (heap.get_size() < static_cast<size_t>(k)) {
+      heap.insert(value);
+    } else if (k > 0 && heap.peek() < value) {
+      heap.replace_top(value);
+    }
+  }
+
+  /// @brief offer the value, it is kept if it is bigger than the smallest
+  /// kept value
+  /// @param value the value, moved only if it is kept
+  void push(T &&value) {
+    if (heap.get_size() < static_cast<size_t>(k)) {
+      heap.insert(std::move(value));
+    } else if (k > 0 && heap.peek() < value) {
+      heap.replace_top(std::move(value));
+    }
+  }
+
+  /// @brief offer a chunk of values
+  /// @param values the chunk
+  /// @param size value count of the chunk
+  void push_range(const T *values, int size) {
+    int i = 0;
+
+    for (; i < size && heap.get_size() < static_cast<size_t>(k); i++) {
+      heap.insert(values[i]);
+    }
+
+    // the rest of the values are compared only if the heap is full, an empty
+    // input or a short chunk leaves no values for the threshold loop
+    if (k == 0 || i == size) {
+      return;
+    }
+
+    // most of the values of a long input are below the threshold, they are
+    // rejected with a single compare against the top, which stays at the
+    // same address while the heap is full
+    const T &threshold = heap.peek();
+
+    for (; i < size; i++) {
+      if (threshold < values[i]) {
+        heap.replace_top(values[i]);
+      }
+    }
+  }
+
+  /// @brief add the kept values of the other accumulator, the result is the
+  /// top k of the both inputs
+  /// @param other accumulator of the same k
+  void merge(const TopK &other) {
+    for (size_t i = 0; i < other.heap.get_size(); i++) {
+      push(other.heap[static_cast<int>(i)]);
+    }
+  }
+
+  /// @brief copy the kept values in the descending order
+  /// @param output has space for get_k() values
+  /// @return the copied value count
+  auto copy_sorted(T *output) const -> int {
+    const int size = get_size();
+
+    for (int i = 0; i < size; i++) {
+      output[i] = heap[i];
+    }
+
+    std::sort(output, output + size, std::greater<T>());
+
+    return size;
+  }
+
+  /// @return the kept values in the descending order
+  auto get_sorted() const -> std::vector<T> {
+    std::vector<T> sorted(get_size());
+    copy_sorted(sorted.data());
+
+    return sorted;
+  }
+
+  /// @brief the smallest kept value, the next value has to be bigger to be
+  /// kept once the accumulator is full
+  auto get_threshold() const -> const T & { return heap.peek(); }
+
+  auto get_size() const noexcept -> int {
+    return static_cast<int>(heap.get_size());
+  }
+  auto get_k() const noexcept -> int { return k; }
+  auto is_full() const noexcept -> bool { return get_size() == k; }
+
+private:
+  int k = 0;
+  DHeap<T, D, false> heap;
+};
+
+/// @brief move the k biggest values to the front of the array in the
+/// descending order, the rest of the array is left in an unspecified order.
+/// Introselect with nth_element, O(n + k log k) and no allocation
+/// @param values the values, reordered
+/// @param size value count
+/// @param k wanted value count
+/// @return the count of the values at the front, min(k, size)
+template <typename T> auto top_k_select(T *values, int size, int k) -> int {
+  if (k <= 0 || size <= 0) {
+    return 0;
+  }
+
+  if (k < size) {
+    std::nth_element(values, values + k - 1, values + size, std::greater<T>());
+  } else {
+    k = size;
+  }
+
+  std::sort(values, values + k, std::greater<T>());
+
+  return k;
+}
+
+/// @brief the k biggest values of the array
+/// @param values the values, not changed
+/// @param size value count
+/// @param k wanted value count
+/// @param algorithm HEAP for k much smaller than the size, SELECT for the
+/// bigger k, it copies the input
+/// @return the values in the descending order
+template <typename T, int D = 4>
+auto top_k(const T *values, int size, int k,
+           eTOP_K_ALGORITHM algorithm = eTOP_K_ALGORITHM::HEAP)
+    -> std::vector<T> {
+  if (algorithm == eTOP_K_ALGORITHM::SELECT) {
+    std::vector<T> selected(values, values + (size > 0 ? size : 0));
+    selected.resize(top_k_select(selected.data(), size, k));
+
+    return selected;
+  }
+
+  TopK<T, D> accumulator(k);
+  accumulator.push_range(values, size);
+
+  return accumulator.get_sorted();
+}
+
+/// @brief the k biggest values of the array, the chunks are scanned by the
+/// pool threads into their own accumulators and the accumulators are merged
+/// @param values the values, not changed
+/// @param size value count
+/// @param k wanted value count
+/// @param thread_pool the pool
+/// @return the values in the descending order
+template <typename T, int D = 4>
+auto parallel_top_k(const T *values, int size, int k,
+                    ThreadPool &thread_pool = ThreadPool::get_default())
+    -> std::vector<T> {
+  const int thread_count = thread_pool.get_thread_count();
+
+  if (size < PXD_TOP_K_PARALLEL_MIN_SIZE || thread_count == 1) {
+    return top_k<T, D>(values, size, k);
+  }
+
+  // a chunk is kept at least k times bigger than its accumulator, otherwise
+  // the merge is the bigger work
+  const int max_task_count = std::max(1, size / std::max(k, 1));
+  const int task_count =
+      std::min(thread_count * PXD_TOP_K_TASKS_PER_THREAD, max_task_count);
+  const int chunk_size = (size + task_count - 1) / task_count;
+
+  // constructed one by one, a copy of an empty accumulator does not keep the
+  // reserved heap
+  std::vector<TopK<T, D>> partials;
+  partials.reserve(task_count);
+
+  for (int i = 0; i < task_count; i++) {
+    partials.emplace_back(k);
+  }
+
+  thread_pool.parallel_for(task_count, [&](int task) {
+    const int first = task * chunk_size;
+    const int last = std::min(size, first + chunk_size);
+
+    if (first < last) {
+      partials[task].push_range(values + first, last - first);
+    }
+  });
+
+  for (int i = 1; i < task_count; i++) {
+    partials[0].merge(partials[i]);
+  }
+
+  return partials[0].get_sorted();
+}
+} // namespace pxd
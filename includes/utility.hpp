@@ -1,6 +1,10 @@
 #pragma once
 
+#include "ds/node_allocator.hpp"
+#include "simd.hpp"
+
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
 namespace pxd {
@@ -10,17 +14,20 @@ constexpr int INDEX_NONE = -1;
 template <typename T> class Array;
 template <typename T> class DynamicArray;
 
-template <typename T> class LinkedList;
-template <typename T> class DoubleLinkedList;
-
 template <typename T, int D, bool is_max_heap> class DHeap;
-template <typename T, int D, bool is_max_heap> class PriorityQueue;
 
-template <typename T> void swap(T &left, T &right) {
-  T temp = left;
-  left = right;
-  right = temp;
-}
+// function object instead of a function template, otherwise the argument
+// dependent lookup of the `using std::swap; swap(a, b);` calls finds it for the
+// pxd types and the call becomes ambiguous
+struct SwapFunc {
+  template <typename T> void operator()(T &left, T &right) const {
+    T temp = left;
+    left = right;
+    right = temp;
+  }
+};
+
+inline constexpr SwapFunc swap{};
 
 constexpr inline double byte2kbyte(size_t size) { return size / 1024.0; }
 constexpr inline double byte2mbyte(size_t size) {
@@ -35,58 +42,65 @@ constexpr inline double kbyte2gbyte(size_t size) {
 }
 constexpr inline double mbyte2gbyte(size_t size) { return size / 1024.0; }
 
-// return the top K elements in ascend order from a raw array
-template <typename T, int D = 4>
-PriorityQueue<T, D, false> topK(T *values, int values_size, int k) {
-  PriorityQueue<T, D, false> pq(k);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+// find functions
 
-  for (int i = 0; i < values_size; i++) {
-    if (pq.get_size() == k && pq.peek() < values[i]) {
-      pq.top();
-    }
+// the contiguous containers are searched with the simd kernels for the
+// arithmetic types, see simd.hpp
 
-    if (pq.get_size() < k) {
-      pq.insert(values[i]);
-    }
-  }
+template <typename T>
+inline int find(const T *values, int size, const T &value) {
+  const int index = simd_find(values, size, value);
 
-  return pq;
+  return index >= 0 ? index : INDEX_NONE;
 }
 
-//////////////////////////////////////////////////////////////////////////////////////////////////////////
-// find functions
+// count the values which are equal to the given value
+template <typename T>
+inline int count(const T *values, int size, const T &value) {
+  return simd_count(values, size, value);
+}
 
-template <typename T> inline int find(Array<T> &&arr, T &&value) {
-  const int length = arr.get_length();
+// mark the equal values in the bitmap which has get_bitmap_word_count(size)
+// words, the bit i % 64 of the word i / 64 is the value i. Returns the count of
+// the equal values
+template <typename T>
+inline int find_all(const T *values, int size, const T &value,
+                    std::uint64_t *bitmap) {
+  return simd_find_all(values, size, value, bitmap);
+}
 
-  for (int i = 0; i < length; i++) {
-    if (value == arr[i]) {
-      return i;
-    }
-  }
+template <typename T>
+inline std::vector<std::uint64_t> find_all(const T *values, int size,
+                                           const T &value) {
+  std::vector<std::uint64_t> bitmap(get_bitmap_word_count(size));
+  simd_find_all(values, size, value, bitmap.data());
 
-  return INDEX_NONE;
+  return bitmap;
 }
 
-template <typename T> inline int find(DynamicArray<T> &&arr, T &&value) {
-  const int length = arr.get_element_count();
-
-  for (int i = 0; i < length; i++) {
-    if (value == arr[i]) {
-      return i;
-    }
-  }
+template <typename T> inline int find(Array<T> &&arr, T &&value) {
+  return find<T>(arr.get_ptr(), arr.get_length(), value);
+}
 
-  return INDEX_NONE;
+template <typename T> inline int find(DynamicArray<T> &&arr, T &&value) {
+  return find<T>(arr.get_data(), arr.get_element_count(), value);
 }
 
+// the std::vector<bool> has no data and the other types may compare with
+// their own operator==, they are searched with std::find
 template <typename T> inline int find_index(std::vector<T> &&vec, T &&value) {
-  auto &&it = std::find(vec.begin(), vec.end(), value);
+  if constexpr (is_simd_searchable_v<T>) {
+    return find<T>(vec.data(), static_cast<int>(vec.size()), value);
+  } else {
+    auto &&it = std::find(vec.begin(), vec.end(), value);
 
-  return it != vec.end() ? it - vec.begin() : INDEX_NONE;
+    return it != vec.end() ? static_cast<int>(it - vec.begin()) : INDEX_NONE;
+  }
 }
 
-template <typename T> inline int find(LinkedList<T> &&ll, T &&value) {
+template <typename T, template <typename> class NodeAllocator>
+inline int find(LinkedList<T, NodeAllocator> &&ll, T &&value) {
   auto &&current_node = ll.get_head_node();
   const int length = ll.get_length();
 
@@ -101,7 +115,8 @@ template <typename T> inline int find(LinkedList<T> &&ll, T &&value) {
   return INDEX_NONE;
 }
 
-template <typename T> inline int find(DoubleLinkedList<T> &&dll, T &&value) {
+template <typename T, template <typename> class NodeAllocator>
+inline int find(DoubleLinkedList<T, NodeAllocator> &&dll, T &&value) {
   auto current_node = dll.get_head_node();
   const int length = dll.get_length();
 
@@ -1,13 +1,23 @@
 #include "test/array_tests.hpp"
 #include "test/binary_search_tree_tests.hpp"
+#include "test/bloom_filter_tests.hpp"
+#include "test/btree_tests.hpp"
 #include "test/double_linked_list_tests.hpp"
+#include "test/dyn_matrix_tests.hpp"
 #include "test/dynamic_array_tests.hpp"
+#include "test/eytzinger_tree_tests.hpp"
 #include "test/linked_list_tests.hpp"
+#include "test/lru_tests.hpp"
 #include "test/matrix_tests.hpp"
+#include "test/multi_queue_tests.hpp"
 #include "test/priority_queue_tests.hpp"
 #include "test/queue_tests.hpp"
 #include "test/regex_tests.hpp"
+#include "test/ring_buffer_tests.hpp"
 #include "test/stack_tests.hpp"
+#include "test/string_tests.hpp"
+#include "test/top_k_tests.hpp"
+#include "test/treap_tests.hpp"
 #include "test/xor_double_linked_list_tests.hpp"
 
 #include "test/test_manager.hpp"
@@ -24,27 +34,47 @@ void do_test() {
   pxd::ArrayTests array_tests;
   pxd::LinkedListTests linked_list_tests;
   pxd::BinarySearchTreeTests binary_search_tree_tests;
+  pxd::BloomFilterTests bloom_filter_tests;
+  pxd::BTreeTests btree_tests;
+  pxd::EytzingerTreeTests eytzinger_tree_tests;
   pxd::StackTests stack_tests;
+  pxd::StringTests string_tests;
   pxd::QueueTests queue_tests;
   pxd::DynamicArrayTests dynamic_array_tests;
   pxd::MatrixTests matrix_tests;
+  pxd::DynMatrixTests dyn_matrix_tests;
   pxd::DoubleLinkedListTests double_linked_list_tests;
   pxd::XORDoubleLinkedListTests xor_double_linked_list_tests;
   pxd::PriorityQueueTests priority_queue_tests;
+  pxd::MultiQueueTests multi_queue_tests;
   pxd::RegexTests regex_tests;
+  pxd::LRUCacheTests lru_cache_tests;
+  pxd::RingBufferTests ring_buffer_tests;
+  pxd::TopKTests top_k_tests;
+  pxd::TreapTests treap_tests;
 
   test_manager.add_test("Array Tests", array_tests);
   test_manager.add_test("Linked List Tests", linked_list_tests);
   test_manager.add_test("Binary Search Tree Tests", binary_search_tree_tests);
+  test_manager.add_test("Bloom Filter Tests", bloom_filter_tests);
+  test_manager.add_test("BTree Tests", btree_tests);
+  test_manager.add_test("Eytzinger Tree Tests", eytzinger_tree_tests);
   test_manager.add_test("Stack Tests", stack_tests);
+  test_manager.add_test("String Tests", string_tests);
   test_manager.add_test("Queue Tests", queue_tests);
   test_manager.add_test("Dynamic Array Tests", dynamic_array_tests);
   test_manager.add_test("Matrix Tests", matrix_tests);
+  test_manager.add_test("Dyn Matrix Tests", dyn_matrix_tests);
   test_manager.add_test("Double Linked List Tests", double_linked_list_tests);
   test_manager.add_test("XOR Double Linked List Tests",
                         xor_double_linked_list_tests);
   test_manager.add_test("Priority Queue Tests", priority_queue_tests);
+  test_manager.add_test("Multi Queue Tests", multi_queue_tests);
   test_manager.add_test("Regex Tests", regex_tests);
+  test_manager.add_test("LRU Cache Tests", lru_cache_tests);
+  test_manager.add_test("Ring Buffer Tests", ring_buffer_tests);
+  test_manager.add_test("Top K Tests", top_k_tests);
+  test_manager.add_test("Treap Tests", treap_tests);
 
   test_manager.print_results();
   test_manager.save_results();
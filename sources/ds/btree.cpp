@@ -0,0 +1 @@
+#include "ds/btree.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/dynamic_ring_buffer.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/eytzinger_tree.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/indexed_dheap.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/multi_queue.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/node_allocator.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "ds/sharded_lru.hpp"
\ No newline at end of file
@@ -0,0 +1 @@
+#include "dyn_matrix.hpp"
\ No newline at end of file
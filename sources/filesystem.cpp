@@ -10,47 +10,56 @@
 #include "core.h"
 
 namespace pxd::fs {
-auto exists(const char *path) -> bool { return std::filesystem::exists(path); }
+namespace {
+// std::filesystem::path owns its chars, the view is copied once into it
+auto to_path(StringView path) -> std::filesystem::path {
+  return std::filesystem::path(path.string_view());
+}
+} // namespace
+
+auto exists(StringView path) -> bool {
+  return std::filesystem::exists(to_path(path));
+}
 
-auto is_dir(const char *path) -> bool {
-  return std::filesystem::is_directory(path);
+auto is_dir(StringView path) -> bool {
+  return std::filesystem::is_directory(to_path(path));
 }
 
-auto is_file(const char *path) -> bool {
-  return std::filesystem::is_regular_file(path);
+auto is_file(StringView path) -> bool {
+  return std::filesystem::is_regular_file(to_path(path));
 }
 
-void mkdir(const char *path) {
+void mkdir(StringView path) {
   if (!exists(path)) {
     return;
   }
 
-  std::filesystem::create_directory(path);
+  std::filesystem::create_directory(to_path(path));
 }
 
-auto get_file_hash(const char *path) -> size_t {
+auto get_file_hash(StringView path) -> size_t {
   if (!exists(path)) {
     return 0;
   }
 
-  return std::filesystem::hash_value(path);
+  return std::filesystem::hash_value(to_path(path));
 }
 
-auto get_relative_path(const char *path) -> String {
-  return String(std::filesystem::relative(path).string());
+auto get_relative_path(StringView path) -> String {
+  return String(std::filesystem::relative(to_path(path)).string());
 }
 
-auto get_absolute_path(const char *path) -> String {
-  return String(std::filesystem::absolute(path).string());
+auto get_absolute_path(StringView path) -> String {
+  return String(std::filesystem::absolute(to_path(path)).string());
 }
 
-auto create_file_symlink(const char *filepath, const char *symlink) -> bool {
+auto create_file_symlink(StringView filepath, StringView symlink) -> bool {
   if (!exists(filepath)) {
     return false;
   }
 
   try {
-    std::filesystem::create_symlink(filepath, symlink);
+    std::filesystem::create_symlink(to_path(filepath), to_path(symlink));
   } catch (const std::exception &e) {
     PXD_LOG_ERROR("Creating {} symlink for {} file is failed", symlink,
                   filepath);
@@ -61,14 +70,15 @@ auto create_file_symlink(const char *filepath, const char *symlink) -> bool {
   return true;
 }
 
-auto create_directory_symlink(const char *dirpath,
-                              const char *symlink) -> bool {
+auto create_directory_symlink(StringView dirpath,
+                              StringView symlink) -> bool {
   if (!exists(dirpath)) {
     return false;
   }
 
   try {
-    std::filesystem::create_directory_symlink(dirpath, symlink);
+    std::filesystem::create_directory_symlink(to_path(dirpath),
+                                              to_path(symlink));
   } catch (const std::exception &e) {
     PXD_LOG_ERROR("Creating {} symlink for {} directory is failed", symlink,
                   dirpath);
@@ -83,12 +93,12 @@ auto getcwd() -> String {
   return String(std::filesystem::current_path().string());
 }
 
-auto get_last_modified_time(const char *path) -> String {
+auto get_last_modified_time(StringView path) -> String {
   if (!exists(path)) {
     return {};
   }
 
-  auto modified_time = std::filesystem::last_write_time(path);
+  auto modified_time = std::filesystem::last_write_time(to_path(path));
 
   try {
     auto system_time =
@@ -100,7 +110,7 @@ auto get_last_modified_time(const char *path) -> String {
   return {};
 }
 
-auto remove_file(const char *path) -> bool {
+auto remove_file(StringView path) -> bool {
   if (!exists(path)) {
     return false;
   }
@@ -109,10 +119,10 @@ auto remove_file(const char *path) -> bool {
     return false;
   }
 
-  return std::filesystem::remove(path);
+  return std::filesystem::remove(to_path(path));
 }
 
-auto remove_folder(const char *path) -> bool {
+auto remove_folder(StringView path) -> bool {
   if (!exists(path)) {
     return false;
   }
@@ -121,14 +131,14 @@ auto remove_folder(const char *path) -> bool {
     return false;
   }
 
-  return std::filesystem::remove_all(path) > 0 ? true : false;
+  return std::filesystem::remove_all(to_path(path)) > 0 ? true : false;
 }
 
 auto get_temp_dir_path() -> String {
   return String(std::filesystem::temp_directory_path().string());
 }
 
-void copy_dir(const char *from_dir, const char *to_dir, bool is_recursive,
+void copy_dir(StringView from_dir, StringView to_dir, bool is_recursive,
               bool update_existed) {
   if (!exists(from_dir)) {
     return;
@@ -144,10 +154,10 @@ void copy_dir(const char *from_dir, const char *to_dir, bool is_recursive,
     copy_ops |= std::filesystem::copy_options::update_existing;
   }
 
-  std::filesystem::copy(from_dir, to_dir, copy_ops);
+  std::filesystem::copy(to_path(from_dir), to_path(to_dir), copy_ops);
 }
 
-void copy_file(const char *from_file, const char *to_file,
+void copy_file(StringView from_file, StringView to_file,
                bool update_existed) {
   if (!exists(from_file)) {
     return;
@@ -159,10 +169,10 @@ void copy_file(const char *from_file, const char *to_file,
     copy_ops |= std::filesystem::copy_options::update_existing;
   }
 
-  std::filesystem::copy_file(from_file, to_file, copy_ops);
+  std::filesystem::copy_file(to_path(from_file), to_path(to_file), copy_ops);
 }
 
-void rename(const char *_old, const char *_new) {
+void rename(StringView _old, StringView _new) {
   if (!exists(_old)) {
     return;
   }
@@ -171,56 +181,56 @@ void rename(const char *_old, const char *_new) {
     return;
   }
 
-  std::filesystem::rename(_old, _new);
+  std::filesystem::rename(to_path(_old), to_path(_new));
 }
 
 } // namespace pxd::fs
 
 namespace pxd::fs::path {
-auto remove_filename(const char *path) -> String {
-  return String(std::filesystem::path(path).remove_filename().string());
+auto remove_filename(StringView path) -> String {
+  return String(to_path(path).remove_filename().string());
 }
 
-auto replace_filename(const char *path, const char *new_filename) -> String {
+auto replace_filename(StringView path, StringView new_filename) -> String {
   return String(
-      std::filesystem::path(path).replace_filename(new_filename).string());
+      to_path(path).replace_filename(to_path(new_filename)).string());
 }
 
-auto replace_extension(const char *path, const char *new_ext) -> String {
+auto replace_extension(StringView path, StringView new_ext) -> String {
   return String(
-      std::filesystem::path(path).replace_extension(new_ext).string());
+      to_path(path).replace_extension(to_path(new_ext)).string());
 }
 
-auto get_root_name(const char *path) -> String {
-  return String(std::filesystem::path(path).root_name().string());
+auto get_root_name(StringView path) -> String {
+  return String(to_path(path).root_name().string());
 }
 
-auto get_root_directory(const char *path) -> String {
-  return String(std::filesystem::path(path).root_directory().string());
+auto get_root_directory(StringView path) -> String {
+  return String(to_path(path).root_directory().string());
 }
 
-auto get_root_path(const char *path) -> String {
-  return String(std::filesystem::path(path).root_path().string());
+auto get_root_path(StringView path) -> String {
+  return String(to_path(path).root_path().string());
 }
 
-auto get_relative_path(const char *path) -> String {
-  return String(std::filesystem::path(path).relative_path().string());
+auto get_relative_path(StringView path) -> String {
+  return String(to_path(path).relative_path().string());
 }
 
-auto get_parent_path(const char *path) -> String {
-  return String(std::filesystem::path(path).parent_path().string());
+auto get_parent_path(StringView path) -> String {
+  return String(to_path(path).parent_path().string());
 }
 
-auto get_filename(const char *path) -> String {
-  return String(std::filesystem::path(path).filename().string());
+auto get_filename(StringView path) -> String {
+  return String(to_path(path).filename().string());
 }
 
-auto get_filename_wo_ext(const char *path) -> String {
-  return String(std::filesystem::path(path).stem().string());
+auto get_filename_wo_ext(StringView path) -> String {
+  return String(to_path(path).stem().string());
 }
 
-auto get_extension_w_dot(const char *path) -> String {
-  return String(std::filesystem::path(path).stem().string());
+auto get_extension_w_dot(StringView path) -> String {
+  return String(to_path(path).stem().string());
 }
 
 } // namespace pxd::fs::path
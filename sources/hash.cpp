@@ -6,6 +6,7 @@
 
 #include "core.h"
 
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
@@ -25,8 +26,7 @@ auto uint8_to_string(const std::array<uint8_t, BLAKE3_OUT_LEN> &computed_hashes)
   return str;
 }
 
-auto pxd::comp_and_get_hash_str(const void *data,
-                                size_t data_length) -> String {
+auto comp_and_get_hash_str(const void *data, size_t data_length) -> String {
   blake3_hasher hasher;
   blake3_hasher_init(&hasher);
 
@@ -39,6 +39,10 @@ auto pxd::comp_and_get_hash_str(const void *data,
   return uint8_to_string(output);
 }
 
+auto comp_and_get_hash_str(StringView data) -> String {
+  return comp_and_get_hash_str(data.data(), data.length());
+}
+
 void comp_hash(const void *data, size_t data_length,
                uint8_t *computed_hash_values) {
   blake3_hasher hasher;
@@ -54,19 +58,18 @@ auto get_hash_str(const std::array<uint8_t, BLAKE3_OUT_LEN> &hashed_values)
   return uint8_to_string(hashed_values);
 }
 
-auto get_file_content_hash_str(const char *filepath) -> String {
-  String hash_str;
-
+auto get_file_content_hash_str(StringView filepath) -> String {
   if (!pxd::fs::exists(filepath)) {
-    PXD_LOG_ERROR("{} is not exists", filepath);
-    return hash_str;
+    PXD_LOG_ERROR("{} is not exists", filepath.string_view());
+    return {};
   }
 
-  std::ifstream file(filepath, std::ifstream::in);
+  std::ifstream file(std::filesystem::path(filepath.string_view()),
+                     std::ifstream::in);
 
   if (!file.good() || !file.is_open()) {
-    PXD_LOG_ERROR("{} cannot opened", filepath);
-    return hash_str;
+    PXD_LOG_ERROR("{} cannot opened", filepath.string_view());
+    return {};
   }
 
   std::stringstream contents;
@@ -75,22 +78,24 @@ auto get_file_content_hash_str(const char *filepath) -> String {
 
   file.close();
 
-  hash_str = std::move(contents.str());
+  // the contents are hashed in place, not copied into a String
+  const std::string contents_str = std::move(contents).str();
 
-  return comp_and_get_hash_str(hash_str.c_str(), hash_str.length());
+  return comp_and_get_hash_str(contents_str);
 }
 
 auto update_hasher_with_file_content(blake3_hasher *hasher,
-                                     const char *filepath) -> bool {
+                                     StringView filepath) -> bool {
   if (!pxd::fs::exists(filepath)) {
-    PXD_LOG_ERROR("{} is not exists", filepath);
+    PXD_LOG_ERROR("{} is not exists", filepath.string_view());
     return false;
   }
 
-  std::ifstream file(filepath, std::ifstream::in);
+  std::ifstream file(std::filesystem::path(filepath.string_view()),
+                     std::ifstream::in);
 
   if (!file.good() || !file.is_open()) {
-    PXD_LOG_ERROR("{} is not exists", filepath);
+    PXD_LOG_ERROR("{} is not exists", filepath.string_view());
     return false;
   }
 
@@ -100,9 +105,9 @@ auto update_hasher_with_file_content(blake3_hasher *hasher,
 
   file.close();
 
-  String hash_str = std::move(String(contents.str()));
+  const std::string contents_str = std::move(contents).str();
 
-  blake3_hasher_update(hasher, hash_str.c_str(), hash_str.length());
+  blake3_hasher_update(hasher, contents_str.data(), contents_str.length());
 
   return true;
 }
@@ -14,51 +14,33 @@ auto check_regex(const RE2 &regex) -> bool {
   return true;
 }
 
-void replace_first(const RE2 &regex, String &base_str, String &new_str) {
+// RE2 rewrites a std::string, the base_str is copied back only if a match is
+// replaced
+void replace_first(const RE2 &regex, String &base_str, StringView new_str) {
   if (!check_regex(regex)) {
     return;
   }
 
-#ifdef PXD_USE_STD_STRING
-  RE2::Replace(&base_str, regex, new_str);
-#else
-  std::string temp_str = base_str;
-  RE2::Replace(&temp_str, regex, new_str);
-  base_str = std::forward<std::string>(temp_str);
-#endif
-}
+  std::string temp_str = base_str.string();
 
-void replace_first(const RE2 &regex, String &base_str, String &&new_str) {
-  replace_first(regex, base_str, new_str);
+  if (RE2::Replace(&temp_str, regex, new_str.string_view())) {
+    base_str.assign(temp_str.data(), temp_str.length());
+  }
 }
 
-void replace_all(const RE2 &regex, String &base_str, String &new_str) {
+void replace_all(const RE2 &regex, String &base_str, StringView new_str) {
   if (!check_regex(regex)) {
     return;
   }
 
-#ifdef PXD_USE_STD_STRING
-  RE2::GlobalReplace(&base_str, regex, new_str);
-#else
-  std::string temp_str(base_str.c_str());
-  RE2::GlobalReplace(&temp_str, regex, new_str);
-  base_str = std::forward<std::string>(temp_str);
-#endif
-}
-
-void replace_all(const RE2 &regex, String &base_str, String &&new_str) {
-  replace_all(regex, base_str, new_str);
-}
+  std::string temp_str = base_str.string();
 
-auto get_escaped_string(String &base_str) -> String {
-#ifdef PXD_USE_STD_STRING
-  return RE2::QuoteMeta(base_str.c_str());
-#else
-  return String(RE2::QuoteMeta(base_str.c_str()));
-#endif
+  if (RE2::GlobalReplace(&temp_str, regex, new_str.string_view()) > 0) {
+    base_str.assign(temp_str.data(), temp_str.length());
+  }
 }
 
-auto get_escaped_string(String &&base_str) -> String {
-  return get_escaped_string(base_str);
+auto get_escaped_string(StringView base_str) -> String {
+  return String(RE2::QuoteMeta(base_str.string_view()));
 }
 } // namespace pxd
@@ -0,0 +1,57 @@
+#include "simd.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace pxd {
+#if PXD_SIMD_ENABLED && defined(_MSC_VER) && !defined(__clang__)
+static auto detect_sse42() noexcept -> bool {
+  int info[4] = {};
+  __cpuid(info, 1);
+
+  return (info[2] & (1 << 20)) != 0;
+}
+
+static auto detect_avx2() noexcept -> bool {
+  int info[4] = {};
+  __cpuid(info, 1);
+
+  // the os has to save the ymm registers too
+  const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+  const bool has_avx = (info[2] & (1 << 28)) != 0;
+
+  if (!has_osxsave || !has_avx || (_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+
+  return (info[1] & (1 << 5)) != 0;
+}
+#elif PXD_SIMD_ENABLED
+static auto detect_sse42() noexcept -> bool {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+}
+
+static auto detect_avx2() noexcept -> bool {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") &&
+         __builtin_cpu_supports("bmi");
+}
+#else
+static auto detect_sse42() noexcept -> bool { return false; }
+static auto detect_avx2() noexcept -> bool { return false; }
+#endif
+
+auto has_sse42() noexcept -> bool {
+  static const bool is_supported = detect_sse42();
+  return is_supported;
+}
+
+auto has_avx2() noexcept -> bool {
+  static const bool is_supported = detect_avx2();
+  return is_supported;
+}
+} // namespace pxd
@@ -2,165 +2,370 @@
 
 #include "format.h"
 #include "regex.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 namespace pxd {
-String::String(const std::string &str) { value = str; }
+// -----------------------------------------------------------------------------
+// -- String Arena
 
-String::String(const char *c_str) {
-#ifdef PXD_USE_STD_STRING
-  value = std::string(c_str);
-#else
-  value = SIMDString<PXD_SIMDSTRING_ALIGNMENT>(c_str);
-#endif
+StringArena::StringArena(StringArena &&other) noexcept
+    : blocks(std::move(other.blocks)), big_blocks(std::move(other.big_blocks)),
+      block_index(other.block_index), current(other.current),
+      remaining_size(other.remaining_size), used_size(other.used_size),
+      block_size(other.block_size) {
+  other.exec_move();
 }
 
-String::String(const SIMDString<PXD_SIMDSTRING_ALIGNMENT> &other) {
-  value = other;
+auto StringArena::operator=(StringArena &&other) noexcept -> StringArena & {
+  if (this == &other) {
+    return *this;
+  }
+
+  release();
+
+  blocks = std::move(other.blocks);
+  big_blocks = std::move(other.big_blocks);
+  block_index = other.block_index;
+  current = other.current;
+  remaining_size = other.remaining_size;
+  used_size = other.used_size;
+  block_size = other.block_size;
+  other.exec_move();
+
+  return *this;
+}
+
+auto StringArena::allocate(std::size_t size) -> char * {
+  // 8 byte aligned buffers
+  size = (size + 7) & ~static_cast<std::size_t>(7);
+  used_size += size;
+
+  if (size > block_size / 4) {
+    // a big buffer would waste the rest of the current block
+    char *buffer = new char[size];
+    big_blocks.push_back(buffer);
+
+    return buffer;
+  }
+
+  if (size > remaining_size) {
+    if (current != nullptr) {
+      block_index++;
+    }
+
+    if (block_index == blocks.size()) {
+      blocks.push_back(new char[block_size]);
+    }
+
+    current = blocks[block_index];
+    remaining_size = block_size;
+  }
+
+  char *buffer = current;
+  current += size;
+  remaining_size -= size;
+
+  return buffer;
+}
+
+void StringArena::release() noexcept {
+  reset();
+
+  for (char *block : blocks) {
+    delete[] block;
+  }
+
+  exec_move();
+}
+
+void StringArena::reset() noexcept {
+  for (char *block : big_blocks) {
+    delete[] block;
+  }
+
+  big_blocks.clear();
+  block_index = 0;
+  current = blocks.empty() ? nullptr : blocks[0];
+  remaining_size = blocks.empty() ? 0 : block_size;
+  used_size = 0;
+}
+
+void StringArena::exec_move() noexcept {
+  blocks.clear();
+  big_blocks.clear();
+  block_index = 0;
+  current = nullptr;
+  remaining_size = 0;
+  used_size = 0;
+}
+
+// -----------------------------------------------------------------------------
+// -- String
+
+String::String(const std::string &str) { assign(str.data(), str.length()); }
+
+String::String(const char *c_str) { assign(c_str, strlen(c_str)); }
+
+String::String(const char *chars, std::size_t chars_length,
+               IStringAllocator *allocator)
+    : allocator(allocator) {
+  assign(chars, chars_length);
+}
+
+String::String(const String &other) {
+  assign(other.data(), other.length());
 }
 
-auto String::operator=(const String &other) -> String & {
 #ifdef PXD_USE_STD_STRING
-  value = other.get_value();
+String::String(String &&other) noexcept
+    : value(std::move(other.value)), allocator(other.allocator) {
+  other.exec_move();
+}
 #else
-  value = other.c_str();
+String::String(String &&other) noexcept
+    : value_length(other.value_length),
+      buffer_capacity(other.buffer_capacity), allocator(other.allocator) {
+  if (other.is_inline()) {
+    memcpy(inline_buffer, other.inline_buffer, value_length + 1);
+  } else {
+    heap_buffer = other.heap_buffer;
+  }
+
+  other.exec_move();
+}
 #endif
 
-  return *this;
+auto String::operator=(const String &other) -> String & {
+  if (this == &other) {
+    return *this;
+  }
+
+  return assign(other.data(), other.length());
 }
 
 auto String::operator=(const std::string &other) -> String & {
-  value = other;
-
-  return *this;
+  return assign(other.data(), other.length());
 }
 
 auto String::operator=(String &&other) noexcept -> String & {
-  value = std::move(std::forward<String>(other).get_value());
+  if (this == &other) {
+    return *this;
+  }
+
+#ifdef PXD_USE_STD_STRING
+  value = std::move(other.value);
+  allocator = other.allocator;
+#else
+  release();
+
+  value_length = other.value_length;
+  buffer_capacity = other.buffer_capacity;
+  allocator = other.allocator;
+
+  if (other.is_inline()) {
+    memcpy(inline_buffer, other.inline_buffer, value_length + 1);
+  } else {
+    heap_buffer = other.heap_buffer;
+  }
+#endif
+
+  other.exec_move();
 
   return *this;
 }
 
 auto String::operator=(std::string &&other) noexcept -> String & {
+#ifdef PXD_USE_STD_STRING
   value = std::move(other);
 
   return *this;
+#else
+  return assign(other.data(), other.length());
+#endif
 }
 
 auto String::operator=(const char *other) -> String & {
-  value = other;
-
-  return *this;
+  return assign(other, strlen(other));
 }
 
-auto String::operator+(const String &other) -> String {
+auto String::assign(const char *chars, std::size_t chars_length) -> String & {
 #ifdef PXD_USE_STD_STRING
-  return absl::StrCat(value, other.get_value());
+  value.assign(chars, chars_length);
+
+  return *this;
 #else
-  return value + other.get_value();
+  if (chars_length > buffer_capacity) {
+    // the old value is not needed, the buffer is replaced without a copy
+    char *new_buffer = allocate_buffer(chars_length);
+    release();
+
+    heap_buffer = new_buffer;
+    buffer_capacity = chars_length;
+  }
+
+  // memmove, the chars may be a part of this string
+  memmove(data(), chars, chars_length);
+  value_length = chars_length;
+  data()[value_length] = '\0';
+
+  return *this;
 #endif
 }
 
-auto String::operator+(String &&other) -> String {
+auto String::append(const char *chars, std::size_t chars_length) -> String & {
 #ifdef PXD_USE_STD_STRING
-  return abls::StrCat(value, std::forward<String>(other).get_value());
+  value.append(chars, chars_length);
+
+  return *this;
 #else
-  return value + std::forward<String>(other).get_value();
+  const std::size_t new_length = value_length + chars_length;
+
+  if (new_length > buffer_capacity) {
+    // the chars may be a part of this string, they are copied before the old
+    // buffer is released
+    const std::size_t new_capacity = std::max(new_length, buffer_capacity * 2);
+    char *new_buffer = allocate_buffer(new_capacity);
+    memcpy(new_buffer, data(), value_length);
+    memcpy(new_buffer + value_length, chars, chars_length);
+    release();
+
+    heap_buffer = new_buffer;
+    buffer_capacity = new_capacity;
+  } else {
+    memmove(data() + value_length, chars, chars_length);
+  }
+
+  value_length = new_length;
+  data()[value_length] = '\0';
+
+  return *this;
 #endif
 }
 
-auto String::operator+(const std::string &other) -> String {
+void String::reserve(std::size_t new_capacity) {
 #ifdef PXD_USE_STD_STRING
-  return absl::StrCat(value + other);
+  value.reserve(new_capacity);
 #else
-  return value + other;
+  if (new_capacity <= buffer_capacity) {
+    return;
+  }
+
+  char *new_buffer = allocate_buffer(new_capacity);
+  memcpy(new_buffer, data(), value_length + 1);
+
+  const std::size_t old_length = value_length;
+  release();
+
+  heap_buffer = new_buffer;
+  buffer_capacity = new_capacity;
+  value_length = old_length;
 #endif
 }
 
-auto String::operator+(std::string &&other) -> String {
+auto String::concat(std::string_view left, std::string_view right) -> String {
+  String result;
+  result.reserve(left.length() + right.length());
+  result.append(left.data(), left.length());
+  result.append(right.data(), right.length());
+
+  return result;
+}
+
 #ifdef PXD_USE_STD_STRING
-  return absl::StrCat(value + std::forward<std::string>(other));
+void String::release() noexcept { std::string().swap(value); }
+
+void String::exec_move() noexcept { value.clear(); }
 #else
-  return value + std::forward<std::string>(other);
+auto String::allocate_buffer(std::size_t new_capacity) -> char * {
+  if (allocator != nullptr) {
+    return allocator->allocate(new_capacity + 1);
+  }
+
+  return new char[new_capacity + 1];
+}
+
+void String::release() noexcept {
+  if (!is_inline()) {
+    if (allocator != nullptr) {
+      allocator->deallocate(heap_buffer, buffer_capacity + 1);
+    } else {
+      delete[] heap_buffer;
+    }
+  }
+
+  exec_move();
+}
+
+/// @brief the empty inline value, the allocator is kept
+void String::exec_move() noexcept {
+  value_length = 0;
+  buffer_capacity = PXD_STRING_INLINE_CAPACITY;
+  inline_buffer[0] = '\0';
+}
 #endif
+
+auto String::operator+(const String &other) -> String {
+  return concat(string_view(), other.string_view());
+}
+
+auto String::operator+(String &&other) -> String {
+  return concat(string_view(), other.string_view());
+}
+
+auto String::operator+(const std::string &other) -> String {
+  return concat(string_view(), other);
+}
+
+auto String::operator+(std::string &&other) -> String {
+  return concat(string_view(), other);
 }
 
 auto String::operator+(const char *other) -> String {
-#ifdef PXD_USE_STD_STRING
-  return absl::StrCat(value, other);
-#else
-  return value + other;
-#endif
+  return concat(string_view(), other);
 }
 
 auto String::operator-(const String &other) -> String {
-  return String(value).replace_all(other.c_str(), "");
+  return String(*this).replace_all(other.c_str(), "");
 }
 
 auto String::operator-(String &&other) -> String {
-  return String(value).replace_all(std::forward<String>(other).c_str(), "");
+  return String(*this).replace_all(other.c_str(), "");
 }
 
 auto String::operator-(const std::string &other) -> String {
-  return String(value).replace_all(other.c_str(), "");
+  return String(*this).replace_all(other.c_str(), "");
 }
 
 auto String::operator-(std::string &&other) -> String {
-  return String(value).replace_all(std::forward<std::string>(other).c_str(),
-                                   "");
+  return String(*this).replace_all(other.c_str(), "");
 }
 
 auto String::operator-(const char *other) -> String {
-  return String(value).replace_all(other, "");
+  return String(*this).replace_all(other, "");
 }
 
 auto String::operator+=(const String &other) -> String & {
-#ifdef PXD_USE_STD_STRING
-  absl::StrAppend(&value, other.get_value());
-#else
-  value += other.get_value();
-#endif
-
-  return *this;
+  return append(other.data(), other.length());
 }
 
 auto String::operator+=(String &&other) -> String & {
-#ifdef PXD_USE_STD_STRING
-  absl::StrAppend(&value, std::forward<String>(other).get_value());
-#else
-  value += std::forward<String>(other).get_value();
-#endif
-
-  return *this;
+  return append(other.data(), other.length());
 }
 
 auto String::operator+=(const std::string &other) -> String & {
-#ifdef PXD_USE_STD_STRING
-  absl::StrAppend(&value, other);
-#else
-  value += other;
-#endif
-
-  return *this;
+  return append(other.data(), other.length());
 }
 
 auto String::operator+=(std::string &&other) -> String & {
-#ifdef PXD_USE_STD_STRING
-  absl::StrAppend(&value, std::forward<std::string>(other));
-#else
-  value += std::forward<std::string>(other);
-#endif
-
-  return *this;
+  return append(other.data(), other.length());
 }
 
 auto String::operator+=(const char *other) -> String & {
-#ifdef PXD_USE_STD_STRING
-  absl::StrAppend(&value, other);
-#else
-  value += other;
-#endif
-
-  return *this;
+  return append(other, strlen(other));
 }
 
 auto String::operator-=(const String &other) -> String & {
@@ -177,9 +382,10 @@ auto String::operator-=(const char *other) -> String & {
 
 auto String::center(int total_length, const char fill_char) -> String & {
   auto format_string = fmt::format("{{:{}^{}}}", fill_char, total_length);
-  auto format_args = fmt::make_format_args(value);
+  const std::string_view view = string_view();
+  auto format_args = fmt::make_format_args(view);
 
-  value = fmt::vformat(format_string.c_str(), format_args);
+  *this = fmt::vformat(format_string.c_str(), format_args);
 
   return *this;
 }
@@ -192,13 +398,9 @@ auto String::replace_first(const char *old_val,
     return *this;
   }
 
-#ifdef PXD_USE_STD_STRING
-  RE2::Replace(&value, regex, new_val);
-#else
   std::string temp_str = string();
   RE2::Replace(&temp_str, regex, new_val);
-  value = std::forward<std::string>(temp_str);
-#endif
+  *this = std::move(temp_str);
 
   return *this;
 }
@@ -210,105 +412,549 @@ auto String::replace_all(const char *old_val, const char *new_val) -> String & {
     return *this;
   }
 
-#ifdef PXD_USE_STD_STRING
-  RE2::GlobalReplace(&value, regex, new_val);
-#else
   std::string temp_str = string();
   RE2::GlobalReplace(&temp_str, regex, new_val);
-  value = std::forward<std::string>(temp_str);
-#endif
+  *this = std::move(temp_str);
 
   return *this;
 }
 
+auto String::replace_many(const StringReplacements &replacements)
+    -> String & {
+  StringReplacer replacer(replacements);
+  // the value is rebuilt on the allocator of the string
+  String output(allocator);
+
+  if (replacer.replace(*this, output) > 0) {
+    *this = std::move(output);
+  }
+
+  return *this;
+}
+
+auto String::replace_many(const StringReplacements &replacements,
+                          String &output) const -> std::size_t {
+  StringReplacer replacer(replacements);
+
+  return replacer.replace(*this, output);
+}
+
 auto operator+(const String &self, const String &other) -> String {
-#ifdef PXD_USE_STD_STRING
-  return absl::StrCat(self.get_value(), other.get_value());
-#else
-  return self.get_value() + other.get_value();
-#endif
+  return String::concat(self, other);
 }
 
 auto operator+(const String &self, String &&other) -> String {
-#ifdef PXD_USE_STD_STRING
-  return absl::StrCat(self.get_value(),
-                      std::forward<String>(other).get_value());
-#else
-  return self.get_value() + std::forward<String>(other).get_value();
-#endif
+  return String::concat(self, other);
 }
 
 auto operator+(const String &self, const std::string &other) -> String {
-#ifdef PXD_USE_STD_STRING
-  return absl::StrCat(self.get_value(), other);
-#else
-  return self.get_value() + other;
-#endif
+  return String::concat(self, other);
 }
 
 auto operator+(const String &self, std::string &&other) -> String {
-#ifdef PXD_USE_STD_STRING
-  return absl::StrCat(self.get_value(), std::forward<std::string>(other));
-#else
-  return self.get_value() + std::forward<std::string>(other);
-#endif
+  return String::concat(self, other);
 }
 
 auto operator+(const String &self, const char *other) -> String {
-  return self.get_value() + other;
+  return String::concat(self, other);
 }
 
 auto operator==(const String &self, const String &other) -> bool {
-  return self.get_value() == other.get_value();
+  return self.string_view() == other.string_view();
 }
 
 auto operator==(const String &self, String &&other) -> bool {
-  return self.get_value() == other.get_value();
+  return self.string_view() == other.string_view();
 }
 
 auto operator==(const String &self, const std::string &other) -> bool {
-  return self.get_value().compare(other) == 0;
+  return self.string_view() == other;
 }
 
 auto operator==(const String &self, std::string &&other) -> bool {
-  return self.get_value().compare(std::forward<std::string>(other)) == 0;
+  return self.string_view() == other;
 }
 
 auto operator==(const String &self, const char *other) -> bool {
-#ifdef PXD_USE_STD_STRING
-  return self.get_value().compare(std::string(other)) == 0;
-#else
-  return self.get_value().compare(other) == 0;
-#endif
+  return self.string_view() == other;
 }
 
 auto operator!=(const String &self, const String &other) -> bool {
-  return self.get_value() != other.get_value();
+  return self.string_view() != other.string_view();
 }
 
 auto operator!=(const String &self, String &&other) -> bool {
-  return self.get_value() != other.get_value();
+  return self.string_view() != other.string_view();
 }
 
 auto operator!=(const String &self, const std::string &other) -> bool {
-  return self.get_value().compare(other) != 0;
+  return self.string_view() != other;
 }
 
 auto operator!=(const String &self, std::string &&other) -> bool {
-  return self.get_value().compare(std::forward<std::string>(other)) != 0;
+  return self.string_view() != other;
 }
 
 auto operator!=(const String &self, const char *other) -> bool {
-#ifdef PXD_USE_STD_STRING
-  return self.get_value().compare(std::string(other)) != 0;
-#else
-  return self.get_value().compare(other) != 0;
+  return self.string_view() != other;
+}
+
+// -----------------------------------------------------------------------------
+// -- String Search
+
+namespace {
+// simd_find and simd_count take an int size, the longer views are searched in
+// chunks
+constexpr std::size_t PXD_STRING_SEARCH_CHUNK = std::size_t(1) << 30;
+
+#if PXD_SIMD_ENABLED
+// the candidates of a needle are the chars where its first and last chars
+// match, only they are compared with memcmp. The loops are instantiated for
+// each kernel with the kernel's target like the simd_find loops
+
+#define PXD_STRING_DEFINE_SEARCH_LOOPS(PREFIX, KERNEL, TARGET)                 \
+  TARGET auto PREFIX##_find_needle(const char *chars, std::size_t length,      \
+                                   StringView needle,                          \
+                                   std::size_t index) noexcept                 \
+      -> std::size_t {                                                         \
+    using Kernel = simd_detail::KERNEL<char>;                                  \
+    constexpr std::size_t lanes = Kernel::lanes;                               \
+    const std::size_t last = needle.length() - 1;                              \
+    const auto first_needle = Kernel::broadcast(needle[0]);                    \
+    const auto last_needle = Kernel::broadcast(needle[last]);                  \
+                                                                               \
+    for (; index + last + lanes <= length; index += lanes) {                   \
+      std::uint32_t mask = Kernel::match(chars + index, first_needle) &        \
+                           Kernel::match(chars + index + last, last_needle);   \
+                                                                               \
+      for (; mask != 0; mask &= mask - 1) {                                    \
+        const std::size_t candidate = index + std::countr_zero(mask);          \
+                                                                               \
+        if (memcmp(chars + candidate, needle.data(), last) == 0) {             \
+          return candidate;                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return std::string_view(chars, length).find(needle, index);                \
+  }                                                                            \
+                                                                               \
+  /* the blocks go backwards from the index, the last candidate wins */        \
+  TARGET auto PREFIX##_rfind_needle(const char *chars, std::size_t length,     \
+                                    StringView needle,                         \
+                                    std::size_t index) noexcept                \
+      -> std::size_t {                                                         \
+    using Kernel = simd_detail::KERNEL<char>;                                  \
+    constexpr std::size_t lanes = Kernel::lanes;                               \
+    const std::size_t last = needle.length() - 1;                              \
+    const auto first_needle = Kernel::broadcast(needle[0]);                    \
+    const auto last_needle = Kernel::broadcast(needle[last]);                  \
+    std::size_t end = index + 1;                                               \
+                                                                               \
+    for (; end >= lanes; end -= lanes) {                                       \
+      const std::size_t start = end - lanes;                                   \
+      std::uint32_t mask = Kernel::match(chars + start, first_needle) &        \
+                           Kernel::match(chars + start + last, last_needle);   \
+                                                                               \
+      while (mask != 0) {                                                      \
+        const int bit = 31 - std::countl_zero(mask);                           \
+        const std::size_t candidate = start + bit;                             \
+                                                                               \
+        if (memcmp(chars + candidate, needle.data(), last) == 0) {             \
+          return candidate;                                                    \
+        }                                                                      \
+                                                                               \
+        mask &= ~(std::uint32_t(1) << bit);                                    \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    return end == 0 ? StringView::npos                                        \
+                    : std::string_view(chars, length).rfind(needle, end - 1);  \
+  }                                                                            \
+                                                                               \
+  TARGET auto PREFIX##_match_block(const char *chars, char byte) noexcept      \
+      -> std::uint64_t {                                                       \
+    using Kernel = simd_detail::KERNEL<char>;                                  \
+    const auto needle = Kernel::broadcast(byte);                               \
+    std::uint64_t mask = 0;                                                    \
+                                                                               \
+    for (int i = 0; i < 64; i += Kernel::lanes) {                              \
+      mask |= std::uint64_t(Kernel::match(chars + i, needle)) << i;            \
+    }                                                                          \
+                                                                               \
+    return mask;                                                               \
+  }
+
+PXD_STRING_DEFINE_SEARCH_LOOPS(sse42, SSEKernel, PXD_SSE42_TARGET)
+PXD_STRING_DEFINE_SEARCH_LOOPS(avx2, AVX2Kernel, PXD_AVX2_TARGET)
+
+#undef PXD_STRING_DEFINE_SEARCH_LOOPS
+
 #endif
+
+/// @param index the needle fits after it
+auto find_needle(const char *chars, std::size_t length, StringView needle,
+                 std::size_t index) noexcept -> std::size_t {
+#if PXD_SIMD_ENABLED
+  if (has_avx2()) {
+    return avx2_find_needle(chars, length, needle, index);
+  }
+
+  if (has_sse42()) {
+    return sse42_find_needle(chars, length, needle, index);
+  }
+#endif
+
+  return std::string_view(chars, length).find(needle, index);
+}
+
+/// @param index the needle fits after it
+auto rfind_needle(const char *chars, std::size_t length, StringView needle,
+                  std::size_t index) noexcept -> std::size_t {
+#if PXD_SIMD_ENABLED
+  if (has_avx2()) {
+    return avx2_rfind_needle(chars, length, needle, index);
+  }
+
+  if (has_sse42()) {
+    return sse42_rfind_needle(chars, length, needle, index);
+  }
+#endif
+
+  return std::string_view(chars, length).rfind(needle, index);
+}
+} // namespace
+
+auto StringView::find(char byte, std::size_t index) const noexcept
+    -> std::size_t {
+  for (; index < view_length; index += PXD_STRING_SEARCH_CHUNK) {
+    const auto size = static_cast<int>(
+        std::min(view_length - index, PXD_STRING_SEARCH_CHUNK));
+    const int found = simd_find(chars + index, size, byte);
+
+    if (found >= 0) {
+      return index + found;
+    }
+  }
+
+  return npos;
+}
+
+auto StringView::find(StringView needle, std::size_t index) const noexcept
+    -> std::size_t {
+  if (index > view_length || needle.length() > view_length - index) {
+    return npos;
+  }
+
+  if (needle.length() <= 1) {
+    return needle.is_empty() ? index : find(needle[0], index);
+  }
+
+  return find_needle(chars, view_length, needle, index);
+}
+
+auto StringView::rfind(char byte, std::size_t index) const noexcept
+    -> std::size_t {
+  return rfind(StringView(&byte, 1), index);
+}
+
+auto StringView::rfind(StringView needle, std::size_t index) const noexcept
+    -> std::size_t {
+  if (needle.length() > view_length) {
+    return npos;
+  }
+
+  index = std::min(index, view_length - needle.length());
+
+  return needle.is_empty() ? index
+                           : rfind_needle(chars, view_length, needle, index);
+}
+
+auto StringView::count(char byte) const noexcept -> std::size_t {
+  std::size_t match_count = 0;
+
+  for (std::size_t index = 0; index < view_length;
+       index += PXD_STRING_SEARCH_CHUNK) {
+    const auto size = static_cast<int>(
+        std::min(view_length - index, PXD_STRING_SEARCH_CHUNK));
+    match_count += simd_count(chars + index, size, byte);
+  }
+
+  return match_count;
+}
+
+auto StringView::count(StringView needle) const noexcept -> std::size_t {
+  if (needle.length() == 1) {
+    return count(needle[0]);
+  }
+
+  if (needle.is_empty()) {
+    return 0;
+  }
+
+  std::size_t match_count = 0;
+
+  for (std::size_t index = find(needle); index != npos;
+       index = find(needle, index + needle.length())) {
+    match_count++;
+  }
+
+  return match_count;
+}
+
+auto StringView::split(char delimiter) const noexcept -> StringSplit {
+  return StringSplit(*this, delimiter);
+}
+
+auto StringView::split(StringView delimiter) const noexcept -> StringSplit {
+  return StringSplit(*this, delimiter);
+}
+
+auto String::split(char delimiter) const noexcept -> StringSplit {
+  return StringSplit(*this, delimiter);
+}
+
+auto String::split(StringView delimiter) const noexcept -> StringSplit {
+  return StringSplit(*this, delimiter);
+}
+
+auto StringSplit::match_block(const char *chars, std::size_t count,
+                              char byte) noexcept -> std::uint64_t {
+#if PXD_SIMD_ENABLED
+  if (count == 64 && has_avx2()) {
+    return avx2_match_block(chars, byte);
+  }
+
+  if (count == 64 && has_sse42()) {
+    return sse42_match_block(chars, byte);
+  }
+#endif
+
+  // the last chars of the input, they are fewer than a block
+  std::uint64_t mask = 0;
+
+  for (std::size_t i = 0; i < count; i++) {
+    mask |= std::uint64_t(chars[i] == byte) << i;
+  }
+
+  return mask;
+}
+
+// -----------------------------------------------------------------------------
+// -- String Replacer
+
+StringReplacer::StringReplacer(const StringReplacements &replacements) {
+  for (const auto &[needle, replacement] : replacements) {
+    for (const char c : needle) {
+      std::uint16_t &byte_class = byte_classes[static_cast<unsigned char>(c)];
+
+      if (byte_class == 0) {
+        byte_class = static_cast<std::uint16_t>(class_count++);
+      }
+    }
+  }
+
+  // the trie of the needles, -1 is a missing transition
+  transitions.assign(class_count, -1);
+
+  for (const auto &[needle, replacement] : replacements) {
+    if (needle.is_empty()) {
+      continue;
+    }
+
+    int state = 0;
+
+    for (const char c : needle) {
+      const std::size_t slot =
+          state * class_count + byte_classes[static_cast<unsigned char>(c)];
+
+      if (transitions[slot] < 0) {
+        transitions[slot] = static_cast<int>(state_outputs.size());
+        state_outputs.push_back(-1);
+        state_depths.push_back(state_depths[state] + 1);
+        transitions.resize(transitions.size() + class_count, -1);
+      }
+
+      state = transitions[slot];
+    }
+
+    if (state_outputs[state] < 0) {
+      state_outputs[state] = static_cast<int>(needle_lengths.size());
+      needle_lengths.push_back(needle.length());
+      this->replacements.emplace_back(replacement);
+    }
+  }
+
+  // breadth first, the missing transitions are taken from the failure state,
+  // so the search never follows the failure links
+  std::vector<int> failures(state_outputs.size(), 0);
+  std::vector<int> queue;
+  queue.reserve(state_outputs.size());
+
+  for (std::size_t c = 0; c < class_count; c++) {
+    if (transitions[c] < 0) {
+      transitions[c] = 0;
+    } else {
+      queue.push_back(transitions[c]);
+    }
+  }
+
+  for (std::size_t head = 0; head < queue.size(); head++) {
+    const int state = queue[head];
+    const int failure = failures[state];
+
+    // the failure state is shorter, its needle is the longest suffix
+    if (state_outputs[state] < 0) {
+      state_outputs[state] = state_outputs[failure];
+    }
+
+    for (std::size_t c = 0; c < class_count; c++) {
+      int &next = transitions[state * class_count + c];
+      const int failure_next = transitions[failure * class_count + c];
+
+      if (next < 0) {
+        next = failure_next;
+      } else {
+        failures[next] = failure_next;
+        queue.push_back(next);
+      }
+    }
+  }
+
+  for (int &next : transitions) {
+    const int row = next * static_cast<int>(class_count);
+    next = state_outputs[next] >= 0 ? ~row : row;
+  }
+}
+
+auto StringReplacer::replace(StringView input, String &output) -> std::size_t {
+  const std::size_t output_length = find_matches(input);
+  const char *chars = input.data();
+  std::size_t position = 0;
+
+  output.clear();
+  output.reserve(output_length);
+
+  for (const Match &match : matches) {
+    output.append(chars + position, match.position - position);
+    output.append(replacements[match.index]);
+    position = match.position + needle_lengths[match.index];
+  }
+
+  output.append(chars + position, input.length() - position);
+
+  return matches.size();
+}
+
+auto StringReplacer::find_matches(StringView input) -> std::size_t {
+  const char *chars = input.data();
+  const std::size_t length = input.length();
+  std::size_t output_length = length;
+  int state = 0;
+  // the leftmost longest needle seen since the last match, a needle which
+  // starts at or before it can still end later while the trie path of the
+  // state starts there
+  Match candidate = {0, -1};
+
+  matches.clear();
+
+  // a single dependent load per byte, a skip of the bytes which start no
+  // needle costs more in the branch misses than it saves
+  for (std::size_t i = 0; i < length || candidate.index >= 0;) {
+    if (i < length) {
+      const auto byte = static_cast<unsigned char>(chars[i]);
+      state = transitions[state + byte_classes[byte]];
+      i++;
+
+      if (state < 0) {
+        state = ~state;
+
+        const int index = state_outputs[state / class_count];
+        const std::size_t position = i - needle_lengths[index];
+
+        // an earlier start, or the same start and a longer needle
+        if (candidate.index < 0 || position <= candidate.position) {
+          candidate = {position, index};
+        }
+      }
+
+      if (candidate.index < 0 ||
+          i - state_depths[state / class_count] <= candidate.position) {
+        continue;
+      }
+    }
+
+    // no needle can extend the candidate any more, the search starts again
+    // after it, so the overlapping needles are skipped
+    matches.push_back(candidate);
+    output_length = output_length - needle_lengths[candidate.index] +
+                    replacements[candidate.index].length();
+    i = candidate.position + needle_lengths[candidate.index];
+    state = 0;
+    candidate = {0, -1};
+  }
+
+  return output_length;
+}
+
+// -----------------------------------------------------------------------------
+// -- String Builder
+
+auto StringBuilder::append_parts(std::initializer_list<StringPart> parts)
+    -> StringBuilder & {
+  std::size_t parts_length = 0;
+
+  for (const StringPart &part : parts) {
+    parts_length += part.get_view().length();
+  }
+
+  buffer.reserve(buffer.size() + parts_length);
+
+  for (const StringPart &part : parts) {
+    const StringView view = part.get_view();
+    buffer.append(view.begin(), view.end());
+  }
+
+  return *this;
 }
 
 namespace str {
 auto to_string(const char *char_arr) -> String { return String(char_arr); }
 
+auto concat_parts(std::initializer_list<StringPart> parts) -> String {
+  std::size_t parts_length = 0;
+
+  for (const StringPart &part : parts) {
+    parts_length += part.get_view().length();
+  }
+
+  String result;
+  result.reserve(parts_length);
+
+  for (const StringPart &part : parts) {
+    result.append(part.get_view());
+  }
+
+  return result;
+}
+
+void append_parts(String &dest, std::initializer_list<StringPart> parts) {
+  std::size_t new_length = dest.length();
+
+  for (const StringPart &part : parts) {
+    new_length += part.get_view().length();
+  }
+
+  // the repeated appends grow the dest twice like the append
+  if (new_length > dest.capacity()) {
+    dest.reserve(std::max(new_length, dest.capacity() * 2));
+  }
+
+  for (const StringPart &part : parts) {
+    dest.append(part.get_view());
+  }
+}
+
 } // namespace str
 
 } // namespace pxd
\ No newline at end of file
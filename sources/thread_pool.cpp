@@ -0,0 +1,105 @@
+#include "thread_pool.hpp"
+
+namespace pxd {
+ThreadPool::ThreadPool(int thread_count) {
+  if (thread_count <= 0) {
+    thread_count = static_cast<int>(std::thread::hardware_concurrency());
+  }
+
+  for (int i = 1; i < thread_count; i++) {
+    workers.emplace_back([this]() { work_loop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    b_stop = true;
+  }
+
+  start_condition.notify_all();
+
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::parallel_for(int task_count,
+                              const std::function<void(int)> &task) {
+  if (task_count <= 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex);
+
+  if (workers.empty() || task_count == 1) {
+    for (int i = 0; i < task_count; i++) {
+      task(i);
+    }
+
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    current_task = &task;
+    this->task_count = task_count;
+    next_task.store(0, std::memory_order_relaxed);
+    running_worker_count = static_cast<int>(workers.size());
+    generation++;
+  }
+
+  start_condition.notify_all();
+  run_tasks();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  done_condition.wait(lock, [this]() { return running_worker_count == 0; });
+  current_task = nullptr;
+}
+
+auto ThreadPool::get_default() -> ThreadPool & {
+  static ThreadPool default_pool;
+  return default_pool;
+}
+
+void ThreadPool::work_loop() {
+  std::uint64_t seen_generation = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      start_condition.wait(lock, [this, seen_generation]() {
+        return b_stop || generation != seen_generation;
+      });
+
+      if (b_stop) {
+        return;
+      }
+
+      seen_generation = generation;
+    }
+
+    run_tasks();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    running_worker_count--;
+
+    if (running_worker_count == 0) {
+      done_condition.notify_one();
+    }
+  }
+}
+
+void ThreadPool::run_tasks() {
+  // the tasks are claimed one by one so the uneven tasks are balanced
+  while (true) {
+    const int task_index = next_task.fetch_add(1, std::memory_order_relaxed);
+
+    if (task_index >= task_count) {
+      return;
+    }
+
+    (*current_task)(task_index);
+  }
+}
+} // namespace pxd
\ No newline at end of file
@@ -0,0 +1 @@
+#include "top_k.hpp"
\ No newline at end of file
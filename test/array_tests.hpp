@@ -2,6 +2,10 @@
 
 #include "array.hpp"
 #include "test_utils.hpp"
+
+#include <string>
+#include <vector>
+
 namespace pxd {
 class ArrayTests : public ITest {
 public:
@@ -21,6 +25,8 @@ public:
     start_copy_ctor_test(temp);
     start_move_ctor_test(temp);
     start_assign_ctor_test(temp);
+    start_where_test();
+    start_count_test();
 
     delete[] temp;
   }
@@ -111,6 +117,52 @@ private:
         check_arrays(arr.get_ptr(), t.get_ptr(), N);
   }
 
+  void start_where_test() {
+    // long enough to pass through the vectorized and the scalar parts
+    Array<int> arr(1000);
+    Array<double> darr(1000);
+
+    for (int i = 0; i < 1000; i++) {
+      arr[i] = i;
+      darr[i] = i * 0.5;
+    }
+
+    test_results["where"] = arr.where(0) == 0 && arr.where(37) == 37 &&
+                            arr.where(999) == 999 &&
+                            arr.where(1000) == INDEX_NONE;
+    test_results["where double"] =
+        darr.where(10.5) == 21 && darr.where(0.25) == INDEX_NONE;
+
+    // the bool and the class types are not searched with the simd kernels
+    test_results["find index"] =
+        find_index(std::vector<int>{4, 5, 6}, 6) == 2 &&
+        find_index(std::vector<bool>{false, false, true}, true) == 2 &&
+        find_index(std::vector<std::string>{"a", "b"}, std::string("b")) ==
+            1 &&
+        find_index(std::vector<std::string>{"a"}, std::string("c")) ==
+            INDEX_NONE;
+  }
+
+  void start_count_test() {
+    Array<short> arr(1000);
+
+    for (int i = 0; i < 1000; i++) {
+      arr[i] = static_cast<short>(i % 7);
+    }
+
+    std::uint64_t bitmap[get_bitmap_word_count(1000)] = {};
+    const int match_count = arr.find_all(3, bitmap);
+
+    bool is_valid = match_count == arr.count(3) && match_count == 143;
+
+    for (int i = 0; i < 1000; i++) {
+      const bool is_marked = (bitmap[i / 64] >> (i % 64)) & 1;
+      is_valid = is_valid && is_marked == (i % 7 == 3);
+    }
+
+    test_results["count and find all"] = is_valid;
+  }
+
 private:
   int N = 10;
 };
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "binary_search_tree.hpp"
+#include "node_allocator.hpp"
 #include "test_utils.hpp"
 
+#include <string>
+#include <utility>
+
 namespace pxd {
 class BinarySearchTreeTests : public ITest {
 public:
@@ -23,6 +27,11 @@ public:
     start_is_contain_test(temp_arr);
     start_min_max_test(temp_arr);
     start_remove_test(temp_arr);
+    start_iterator_test(temp_arr);
+    start_bound_test(temp_arr);
+    start_remove_root_test(temp_arr);
+    start_avl_test();
+    start_pool_allocator_test();
 
     delete[] check_arr;
     delete[] temp_arr;
@@ -109,6 +118,190 @@ private:
     test_results["remove"] = bst.get_total_node_count() == 0;
   }
 
+  void start_iterator_test(int *temp_arr) {
+    BinarySearchTree<int> bst(temp_arr, N, true);
+
+    int inorder_arr[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int preorder_arr[10] = {5, 2, 1, 3, 4, 8, 6, 7, 9, 10};
+    int postorder_arr[10] = {1, 4, 3, 2, 7, 6, 10, 9, 8, 5};
+
+    test_results["inorder iterator"] =
+        check_order(bst, eBST_ORDER::INORDER, inorder_arr);
+    test_results["preorder iterator"] =
+        check_order(bst, eBST_ORDER::PREORDER, preorder_arr);
+    test_results["postorder iterator"] =
+        check_order(bst, eBST_ORDER::POSTORDER, postorder_arr);
+
+    BinarySearchTree<int> empty_bst;
+
+    test_results["empty iterator"] =
+        empty_bst.begin() == empty_bst.end() &&
+        empty_bst.begin(eBST_ORDER::POSTORDER) == empty_bst.end();
+  }
+
+  void start_bound_test(int *temp_arr) {
+    BinarySearchTree<int> bst(temp_arr, N, true);
+
+    int range_arr[5] = {3, 4, 5, 6, 7};
+    int index = 0;
+    bool is_valid = true;
+
+    for (auto it = bst.lower_bound(3); it != bst.upper_bound(7); ++it) {
+      is_valid = is_valid && index < 5 && *it == range_arr[index];
+      index++;
+    }
+
+    test_results["lower upper bound"] =
+        is_valid && index == 5 && *bst.lower_bound(0) == 1 &&
+        *bst.upper_bound(9) == 10 && bst.lower_bound(11) == bst.end() &&
+        bst.upper_bound(10) == bst.end();
+  }
+
+  void start_remove_root_test(int *temp_arr) {
+    BinarySearchTree<int> bst(temp_arr, N, true);
+
+    // 5 is the root of the balanced tree
+    bst.remove(5);
+    bst.remove(8);
+
+    int expected_arr[8] = {1, 2, 3, 4, 6, 7, 9, 10};
+    int index = 0;
+    bool is_valid = bst.get_total_node_count() == 8;
+
+    for (int value : bst) {
+      is_valid = is_valid && index < 8 && value == expected_arr[index];
+      index++;
+    }
+
+    test_results["remove root"] = is_valid && index == 8;
+  }
+
+  void start_avl_test() {
+    BinarySearchTree<int> bst(eBST_BALANCE::AVL);
+
+    for (int i = 0; i < 1000; i++) {
+      bst.add(i);
+    }
+
+    bst.add(500);
+
+    bool is_valid = bst.get_total_node_count() == 1000 && check_avl(bst);
+    int expected = 0;
+
+    for (int value : bst) {
+      is_valid = is_valid && value == expected;
+      expected++;
+    }
+
+    test_results["avl sorted add"] = is_valid && expected == 1000;
+
+    for (int i = 0; i < 1000; i += 2) {
+      bst.remove(i);
+    }
+
+    bst.remove(2000);
+
+    is_valid = bst.get_total_node_count() == 500 && check_avl(bst) &&
+               bst.is_contain(999) && !bst.is_contain(998);
+
+    BinarySearchTree<int> copy_bst(bst);
+
+    test_results["avl remove"] = is_valid && check_avl(copy_bst) &&
+                                 copy_bst.get_balance() == eBST_BALANCE::AVL;
+
+    BinarySearchTree<int> list_bst;
+
+    for (int i = 0; i < 100; i++) {
+      list_bst.add(i);
+    }
+
+    list_bst.set_balance(eBST_BALANCE::AVL);
+    list_bst.add(100);
+    list_bst.remove(0);
+
+    test_results["set balance"] = list_bst.get_total_node_count() == 100 &&
+                                  check_avl(list_bst) &&
+                                  list_bst.get_min_value() == 1;
+  }
+
+  void start_pool_allocator_test() {
+    BinarySearchTree<int, PoolNodeAllocator> bst(eBST_BALANCE::AVL);
+    bst.reserve(1000);
+
+    for (int i = 0; i < 1000; i++) {
+      bst.add(i);
+    }
+
+    // the removed nodes are recycled by the adds
+    for (int i = 0; i < 1000; i += 2) {
+      bst.remove(i);
+    }
+
+    for (int i = 1000; i < 1500; i++) {
+      bst.add(i);
+    }
+
+    BinarySearchTree<int, PoolNodeAllocator> moved_bst(std::move(bst));
+
+    test_results["pool allocator"] = moved_bst.get_total_node_count() == 1000 &&
+                                     check_avl(moved_bst) &&
+                                     moved_bst.is_contain(1499) &&
+                                     !moved_bst.is_contain(998) &&
+                                     bst.get_root() == nullptr;
+
+    // the nodes which are not trivially destructible are destroyed one by one
+    BinarySearchTree<std::string, PoolNodeAllocator> string_bst;
+
+    for (int i = 0; i < 100; i++) {
+      string_bst.add(std::to_string(i) + " long enough to be on the heap");
+    }
+
+    string_bst.remove("5 long enough to be on the heap");
+    moved_bst.release();
+    moved_bst.add(1);
+
+    test_results["pool allocator release"] =
+        string_bst.get_total_node_count() == 99 &&
+        moved_bst.get_total_node_count() == 1 && moved_bst.is_contain(1);
+  }
+
+  /// @brief every node keeps its height and the heights of its subtrees
+  /// differ by at most 1
+  template <template <typename> class NodeAllocator>
+  static auto check_avl(const BinarySearchTree<int, NodeAllocator> &bst)
+      -> bool {
+    bool is_valid = true;
+
+    for (auto it = bst.begin(eBST_ORDER::POSTORDER); it != bst.end(); ++it) {
+      BSTNode<int> *node = it.get_node();
+      const int left_height = node->left != nullptr ? node->left->height : 0;
+      const int right_height =
+          node->right != nullptr ? node->right->height : 0;
+      const int difference = left_height - right_height;
+
+      is_valid = is_valid && difference >= -1 && difference <= 1 &&
+                 node->height ==
+                     (left_height > right_height ? left_height
+                                                 : right_height) +
+                         1;
+    }
+
+    return is_valid;
+  }
+
+  auto check_order(const BinarySearchTree<int> &bst, eBST_ORDER order,
+                   int *expected_arr) -> bool {
+    int index = 0;
+    bool is_valid = true;
+
+    for (auto it = bst.begin(order); it != bst.end(); it++) {
+      is_valid = is_valid && index < N && *it == expected_arr[index];
+      index++;
+    }
+
+    return is_valid && index == N;
+  }
+
 private:
   int N = 10;
 };
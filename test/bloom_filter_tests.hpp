@@ -0,0 +1,138 @@
+#pragma once
+
+#include "bloom_filter.hpp"
+#include "test_utils.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pxd {
+class BloomFilterTests : public ITest {
+public:
+  void start_test() override {
+    start_add_contains_tests();
+    start_sizing_tests();
+    start_batch_tests();
+  }
+
+private:
+  void start_add_contains_tests() {
+    BloomFilter filter;
+    filter.add(std::string("apple"));
+    filter.add(std::string("banana"));
+
+    const bool is_empty_filter_valid =
+        !BloomFilter().contains(std::string("apple"));
+
+    test_results["add contains"] = is_empty_filter_valid &&
+                                   filter.contains(std::string("apple")) &&
+                                   filter.contains(std::string("banana")) &&
+                                   filter.get_bit_count() == 1024 &&
+                                   filter.get_hash_count() == 3;
+
+    filter.clear();
+
+    test_results["clear"] = !filter.contains(std::string("apple")) &&
+                            filter.get_false_positive_rate() == 0.0;
+  }
+
+  void start_sizing_tests() {
+    // m = ceil(-1000 ln(0.01) / ln(2)^2) = 9586 bits, rounded up to 9600,
+    // k = round(9586 / 1000 ln(2)) = 7
+    BloomFilter filter = BloomFilter::for_false_positive_rate(1000, 0.01);
+    bool is_valid =
+        filter.get_bit_count() == 9600 && filter.get_hash_count() == 7;
+
+    for (int i = 0; i < 1000; i++) {
+      filter.add(i);
+    }
+
+    for (int i = 0; i < 1000; i++) {
+      is_valid = is_valid && filter.contains(i);
+    }
+
+    int false_positive_count = 0;
+
+    for (int i = 1000; i < 101'000; i++) {
+      false_positive_count += filter.contains(i);
+    }
+
+    // 1% of 100K values, the double hashing keeps it close to the target
+    test_results["sizing"] = is_valid && false_positive_count < 2000 &&
+                             filter.get_false_positive_rate() < 0.02;
+
+    // 300M values need 2875517514 bits, more than an int holds, and
+    // k = round(2875517514 / 300M ln(2)) = 7
+    const std::uint64_t large_bit_count =
+        BloomFilter::get_optimal_bit_count(300'000'000, 0.01);
+
+    test_results["large sizing"] =
+        large_bit_count == 2'875'517'514ULL &&
+        BloomFilter::get_optimal_hash_count(300'000'000, large_bit_count) == 7;
+
+    // the invalid arguments are clamped in the release builds too, the
+    // filter keeps at least a bit and a hash
+    BloomFilter empty_filter = BloomFilter::for_false_positive_rate(0, 1.0);
+    empty_filter.add(1);
+    BloomFilter zero_filter(0, 0);
+    zero_filter.add(1);
+
+    test_results["sizing guards"] =
+        BloomFilter::get_optimal_bit_count(0, 0.01) ==
+            BloomFilter::get_optimal_bit_count(1, 0.01) &&
+        BloomFilter::get_optimal_bit_count(1000, 1.0) == 1 &&
+        BloomFilter::get_optimal_bit_count(1000, 2.0) == 1 &&
+        BloomFilter::get_optimal_bit_count(1000, 0.0) ==
+            BloomFilter::get_optimal_bit_count(1000, -1.0) &&
+        BloomFilter::get_optimal_bit_count(1000, 0.0) < 2'000'000 &&
+        BloomFilter::get_optimal_hash_count(0, 0) == 1 &&
+        BloomFilter::get_optimal_hash_count(1, 1'000'000) == 32 &&
+        empty_filter.get_bit_count() == 64 &&
+        empty_filter.get_hash_count() == 1 && empty_filter.contains(1) &&
+        zero_filter.get_bit_count() == 64 &&
+        zero_filter.get_hash_count() == 1 && zero_filter.contains(1);
+  }
+
+  void start_batch_tests() {
+    // not a multiple of the batch size
+    const int size = 1000;
+    std::vector<int> values(size);
+
+    for (int i = 0; i < size; i++) {
+      values[i] = i * 3;
+    }
+
+    BloomFilter batch_filter = BloomFilter::for_false_positive_rate(size, 0.01);
+    BloomFilter filter = BloomFilter::for_false_positive_rate(size, 0.01);
+    batch_filter.add_batch(values.data(), size - 1);
+
+    for (int i = 0; i < size - 1; i++) {
+      filter.add(values[i]);
+    }
+
+    std::vector<int> queries(3 * size);
+
+    for (int i = 0; i < 3 * size; i++) {
+      queries[i] = i;
+    }
+
+    std::unique_ptr<bool[]> results(new bool[3 * size]);
+    batch_filter.contains_batch(queries.data(), 3 * size, results.get());
+
+    bool is_valid = true;
+
+    for (int i = 0; i < 3 * size; i++) {
+      is_valid = is_valid && results[i] == filter.contains(queries[i]) &&
+                 results[i] == batch_filter.contains(queries[i]);
+    }
+
+    for (int i = 0; i < size - 1; i++) {
+      is_valid = is_valid && results[values[i]];
+    }
+
+    test_results["batch"] = is_valid;
+  }
+};
+} // namespace pxd
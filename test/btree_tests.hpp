@@ -0,0 +1,103 @@
+#pragma once
+
+#include "btree.hpp"
+#include "test_utils.hpp"
+
+#include <set>
+#include <vector>
+
+namespace pxd {
+class BTreeTests : public ITest {
+public:
+  void start_test() override {
+    start_insert_remove_tests();
+    start_lower_bound_tests();
+    start_copy_move_tests();
+  }
+
+private:
+  template <int Fanout>
+  static auto check_keys(const BTree<int, Fanout> &tree,
+                         const std::set<int> &expected) -> bool {
+    std::vector<int> keys;
+    tree.for_each([&keys](int key) { keys.push_back(key); });
+
+    return tree.get_size() == static_cast<int>(expected.size()) &&
+           keys == std::vector<int>(expected.begin(), expected.end());
+  }
+
+  /// @brief the same random inserts and removes on the tree and a std::set,
+  /// enough keys for a few levels of the smallest fanout
+  template <int Fanout> static auto check_random_operations() -> bool {
+    BTree<int, Fanout> tree;
+    std::set<int> expected;
+    bool is_valid = true;
+
+    for (int i = 0; i < 5000 && is_valid; i++) {
+      const int key = (i * 7919) % 1000;
+
+      if (i % 3 == 2) {
+        is_valid = tree.remove(key) == (expected.erase(key) == 1);
+      } else {
+        is_valid = tree.insert(key) == expected.insert(key).second;
+      }
+    }
+
+    is_valid = is_valid && check_keys(tree, expected);
+
+    for (int key = 0; key < 1000 && is_valid; key++) {
+      is_valid = tree.contains(key) == (expected.count(key) == 1);
+    }
+
+    for (int key = 0; key < 1000 && is_valid; key++) {
+      is_valid = tree.remove(key) == (expected.erase(key) == 1);
+    }
+
+    return is_valid && tree.is_empty() && tree.get_height() == 0;
+  }
+
+  void start_insert_remove_tests() {
+    test_results["insert remove fanout 4"] = check_random_operations<4>();
+    test_results["insert remove fanout 16"] = check_random_operations<16>();
+    test_results["insert remove fanout 128"] = check_random_operations<128>();
+  }
+
+  void start_lower_bound_tests() {
+    BTree<int, 4> tree;
+
+    for (int i = 0; i < 100; i++) {
+      tree.insert(i * 2);
+    }
+
+    bool is_valid = tree.lower_bound(199) == nullptr &&
+                    *tree.lower_bound(-5) == 0 && tree.get_height() > 2;
+
+    for (int key = 0; key < 198 && is_valid; key++) {
+      is_valid = *tree.lower_bound(key) == (key + 1) / 2 * 2;
+    }
+
+    test_results["lower bound"] = is_valid;
+  }
+
+  void start_copy_move_tests() {
+    BTree<int, 4> tree;
+    std::set<int> expected;
+
+    for (int i = 0; i < 100; i++) {
+      tree.insert(i);
+      expected.insert(i);
+    }
+
+    BTree<int, 4> copy(tree);
+    copy.remove(50);
+
+    BTree<int, 4> moved(std::move(copy));
+    std::set<int> moved_expected = expected;
+    moved_expected.erase(50);
+
+    test_results["copy move"] = check_keys(tree, expected) &&
+                                check_keys(moved, moved_expected) &&
+                                copy.is_empty();
+  }
+};
+} // namespace pxd
@@ -25,6 +25,8 @@ public:
     start_index_test(temp_arr);
     start_remove_test(temp_arr);
     start_where_test(temp_arr);
+    start_move_node_test(temp_arr, check_arr);
+    start_pool_test(temp_arr, check_arr);
 
     delete[] temp_arr;
     delete[] check_arr;
@@ -149,6 +151,37 @@ private:
     test_results["where 2"] = dll.where(5) == 4;
   }
 
+  void start_move_node_test(int *temp_arr, int *check_arr) {
+    DoubleLinkedList<int> dll(temp_arr, N);
+    dll.move_to_end(dll.get_head_node());
+    dll.to_array(check_arr);
+
+    test_results["move to end"] = check_arrays<int>(temp_arr, 1, check_arr, 0,
+                                                    N - 1) &&
+                                  check_arr[N - 1] == temp_arr[0];
+
+    dll.move_to_head(dll.get_end_node());
+    dll.to_array(check_arr);
+
+    test_results["move to head"] = check_arrays<int>(temp_arr, check_arr, N);
+  }
+
+  void start_pool_test(int *temp_arr, int *check_arr) {
+    DoubleLinkedList<int, PoolNodeAllocator> dll;
+    dll.reserve(N);
+    dll.from_array(temp_arr, N);
+
+    dll.remove_at(4);
+    dll.remove(1);
+
+    DoubleLinkedList<int, PoolNodeAllocator> temp_dll(dll);
+    temp_dll.add(1, false);
+    temp_dll.to_array(check_arr);
+
+    test_results["pool allocator"] =
+        check_arrays<int>(temp_arr, check_arr, 4) && check_arr[4] == 6;
+  }
+
 private:
   int N = 10;
 };
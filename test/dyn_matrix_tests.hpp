@@ -0,0 +1,155 @@
+#pragma once
+
+#include "dyn_matrix.hpp"
+#include "test_utils.hpp"
+
+#include <cstdint>
+
+namespace pxd {
+class DynMatrixTests : public ITest {
+public:
+  void start_test() override {
+    start_ctor_tests();
+    start_copy_move_tests();
+    start_order_tests();
+    start_element_wise_tests();
+    start_multiply_tests();
+  }
+
+private:
+  void start_ctor_tests() {
+    int values[6] = {1, 2, 3, 4, 5, 6};
+    DynMatrix<int> matrix(values, 2, 3);
+    DynMatrix<int> column_matrix(values, 2, 3, false);
+
+    bool is_aligned = true;
+
+    for (int i = 0; i < matrix.get_row(); i++) {
+      is_aligned = is_aligned && reinterpret_cast<std::uintptr_t>(
+                                     matrix[i].get_ptr()) %
+                                         PXD_DYN_MATRIX_ALIGNMENT ==
+                                     0;
+    }
+
+    test_results["array ctor"] = matrix(0, 2) == 3 && matrix(1, 0) == 4 &&
+                                 matrix[1][2] == 6 && is_aligned;
+    test_results["column order ctor"] =
+        column_matrix(0, 1) == 3 && column_matrix(1, 0) == 2 &&
+        column_matrix.get_column_view(2)[1] == 6;
+  }
+
+  void start_copy_move_tests() {
+    int values[6] = {1, 2, 3, 4, 5, 6};
+    DynMatrix<int> matrix(values, 3, 2);
+    DynMatrix<int> copy(matrix);
+    copy(0, 0) = 100;
+
+    DynMatrix<int> moved(std::move(copy));
+
+    int result[6];
+    matrix.to_array(result);
+
+    test_results["copy move ctor"] = check_arrays<int>(result, values, 6) &&
+                                     moved(0, 0) == 100 && copy.is_empty() &&
+                                     moved.get_row() == 3;
+  }
+
+  void start_order_tests() {
+    int values[6] = {1, 2, 3, 4, 5, 6};
+    DynMatrix<int> matrix(values, 2, 3);
+
+    matrix.transpose();
+
+    bool is_valid = matrix.get_row() == 3 && matrix.get_column() == 2 &&
+                    !matrix.is_row_order();
+
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 2; j++) {
+        is_valid = is_valid && matrix(i, j) == values[j * 3 + i];
+      }
+    }
+
+    test_results["transpose"] = is_valid;
+
+    matrix.change_order();
+
+    int result[6];
+    matrix.to_array(result);
+    int expected[6] = {1, 4, 2, 5, 3, 6};
+
+    test_results["change order"] = matrix.is_row_order() &&
+                                   matrix(2, 1) == 6 &&
+                                   check_arrays<int>(result, expected, 6);
+  }
+
+  void start_element_wise_tests() {
+    DynMatrix<int> row_matrix(3, 5);
+    DynMatrix<int> column_matrix(3, 5, false);
+
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 5; j++) {
+        row_matrix(i, j) = i * 5 + j;
+        column_matrix(i, j) = 1;
+      }
+    }
+
+    DynMatrix<int> sum = row_matrix + row_matrix;
+    DynMatrix<int> mixed = row_matrix - column_matrix;
+    sum *= 2;
+
+    bool is_valid = true;
+
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 5; j++) {
+        is_valid = is_valid && sum(i, j) == (i * 5 + j) * 4 &&
+                   mixed(i, j) == i * 5 + j - 1;
+      }
+    }
+
+    test_results["element wise"] = is_valid;
+  }
+
+  void start_multiply_tests() {
+    // crosses the row, the column and the depth blocks with remainders
+    constexpr int rows = 70;
+    constexpr int depth = 300;
+    constexpr int columns = 270;
+
+    DynMatrix<float> left(rows, depth);
+    DynMatrix<float> right(depth, columns, false);
+
+    for (int i = 0; i < rows; i++) {
+      for (int k = 0; k < depth; k++) {
+        left(i, k) = static_cast<float>((i + k) % 5);
+      }
+    }
+
+    for (int k = 0; k < depth; k++) {
+      for (int j = 0; j < columns; j++) {
+        right(k, j) = static_cast<float>((k * 3 + j) % 7) - 3.0f;
+      }
+    }
+
+    ThreadPool thread_pool(4);
+    DynMatrix<float> product = left.multiply(right, thread_pool);
+
+    bool is_valid = product.get_row() == rows &&
+                    product.get_column() == columns && product.is_row_order();
+
+    for (int i = 0; i < rows && is_valid; i++) {
+      for (int j = 0; j < columns; j++) {
+        float expected = 0.0f;
+
+        for (int k = 0; k < depth; k++) {
+          expected += left(i, k) * right(k, j);
+        }
+
+        // small integers, the sum is exact in any order
+        is_valid = is_valid && product(i, j) == expected;
+      }
+    }
+
+    test_results["multiply"] = is_valid;
+  }
+};
+} // namespace pxd
@@ -3,6 +3,8 @@
 #include "dynamic_array.hpp"
 #include "test_utils.hpp"
 
+#include <string>
+
 namespace pxd {
 class DynamicArrayTests : public ITest {
 public:
@@ -21,6 +23,11 @@ public:
     start_shrink_test(temp_arr);
     start_index_test(temp_arr);
     start_resize_test(temp_arr);
+    start_growth_test();
+    start_emplace_test();
+    start_reserve_test(temp_arr);
+    start_remove_last_test();
+    start_where_test();
 
     delete[] temp_arr;
   }
@@ -116,6 +123,95 @@ private:
     test_results["resize"] = check_arrays<int>(darray.get_data(), temp_arr, N);
   }
 
+  void start_growth_test() {
+    DynamicArray<int> darray;
+    DynamicArray<int> fixed_darray;
+    fixed_darray.set_growth_policy(eGROWTH_POLICY::FIXED);
+
+    for (int i = 0; i < 100; i++) {
+      darray.add(i);
+      fixed_darray.add(i);
+    }
+
+    // 5, 10, 20, 40, 80, 160 for the geometric growth
+    test_results["geometric growth"] =
+        darray.get_total_capacity() == 160 && darray[99] == 99;
+    test_results["fixed growth"] =
+        fixed_darray.get_total_capacity() == 100 && fixed_darray[-1] == 99;
+  }
+
+  void start_emplace_test() {
+    DynamicArray<std::string> darray;
+
+    for (int i = 0; i < N * 10; i++) {
+      darray.emplace_back(static_cast<size_t>(i + 1), 'a');
+    }
+
+    // the value refers to the array itself while the array grows
+    DynamicArray<std::string> self_darray;
+    self_darray.emplace_back("value");
+
+    for (int i = 0; i < N; i++) {
+      self_darray.add(self_darray[0]);
+    }
+
+    DynamicArray<std::string> copy_darray(darray);
+
+    test_results["emplace back"] = darray[N - 1] == std::string(N, 'a') &&
+                                   darray.get_element_count() == N * 10 &&
+                                   self_darray[-1] == "value" &&
+                                   copy_darray[-1] == darray[-1];
+  }
+
+  void start_reserve_test(int *temp_arr) {
+    DynamicArray<int> darray;
+    darray.reserve(N * 10);
+
+    const int *data = darray.get_data();
+
+    for (int i = 0; i < N; i++) {
+      darray.add(temp_arr[i]);
+    }
+
+    test_results["reserve"] = darray.get_total_capacity() == N * 10 &&
+                              darray.get_data() == data &&
+                              check_arrays<int>(darray.get_data(), temp_arr, N);
+  }
+
+  void start_remove_last_test() {
+    DynamicArray<int> darray;
+    darray.reserve(64);
+
+    for (int i = 0; i < 20; i++) {
+      darray.add(i);
+    }
+
+    // not shrunk until the quarter of the capacity is used
+    bool is_valid = darray.remove_last() == 19 && darray.remove_last() == 18 &&
+                    darray.get_total_capacity() == 64;
+
+    while (darray.get_element_count() > 0) {
+      darray.remove_last();
+    }
+
+    test_results["remove last"] =
+        is_valid && darray.get_total_capacity() < 16;
+  }
+
+  void start_where_test() {
+    DynamicArray<int> darray;
+    darray.reserve(200);
+
+    for (int i = 0; i < 100; i++) {
+      darray.add(i % 10);
+    }
+
+    // the unused capacity is not searched
+    test_results["where"] = darray.where(9) == 9 && darray.count(9) == 10 &&
+                            darray.where(42) == INDEX_NONE &&
+                            darray.count(0) == 10;
+  }
+
 private:
   int N = 10;
 };
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "eytzinger_tree.hpp"
+#include "test_utils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace pxd {
+class EytzingerTreeTests : public ITest {
+public:
+  void start_test() override {
+    start_search_tests();
+    start_copy_move_tests();
+  }
+
+private:
+  /// @brief the even numbers 0, 2, ..., (size - 1) * 2
+  static auto make_sorted(int size) -> std::vector<int> {
+    std::vector<int> values(size);
+
+    for (int i = 0; i < size; i++) {
+      values[i] = i * 2;
+    }
+
+    return values;
+  }
+
+  /// @brief compare the bounds with the std ones for every key around the
+  /// values, the sizes are not powers of two
+  static auto check_bounds(const EytzingerTree<int> &tree,
+                           const std::vector<int> &values) -> bool {
+    const int size = static_cast<int>(values.size());
+    bool is_valid = tree.get_size() == size;
+
+    for (int key = -1; key <= size * 2 && is_valid; key++) {
+      auto lower = std::lower_bound(values.begin(), values.end(), key);
+      auto upper = std::upper_bound(values.begin(), values.end(), key);
+      const int *tree_lower = tree.lower_bound(key);
+      const int *tree_upper = tree.upper_bound(key);
+
+      const bool is_member = key >= 0 && key < size * 2 && key % 2 == 0;
+
+      is_valid =
+          (lower == values.end() ? tree_lower == nullptr
+                                 : tree_lower != nullptr &&
+                                       *tree_lower == *lower) &&
+          (upper == values.end() ? tree_upper == nullptr
+                                 : tree_upper != nullptr &&
+                                       *tree_upper == *upper) &&
+          tree.contains(key) == is_member;
+    }
+
+    return is_valid;
+  }
+
+  void start_search_tests() {
+    bool is_valid = true;
+
+    for (int size : {1, 2, 7, 100, 1000}) {
+      std::vector<int> values = make_sorted(size);
+      EytzingerTree<int> tree(values.data(), size);
+
+      is_valid = is_valid && check_bounds(tree, values);
+    }
+
+    EytzingerTree<int> empty_tree;
+
+    test_results["lower upper bound"] = is_valid &&
+                                        empty_tree.lower_bound(1) == nullptr &&
+                                        !empty_tree.contains(1);
+  }
+
+  void start_copy_move_tests() {
+    std::vector<int> values = make_sorted(100);
+    EytzingerTree<int> tree(values.data(), 100);
+    EytzingerTree<int> copy(tree);
+    EytzingerTree<int> moved(std::move(tree));
+
+    test_results["copy move"] = check_bounds(copy, values) &&
+                                check_bounds(moved, values) && tree.is_empty();
+  }
+};
+} // namespace pxd
@@ -23,6 +23,7 @@ public:
     start_move_ctor_test(temp);
     start_assign_ctor_test(temp);
     start_remove_test(temp);
+    start_pool_test(temp);
 
     delete[] temp_arr;
     delete[] temp;
@@ -135,6 +136,23 @@ private:
         !check_arrays<int>(temp_arr, 0, arr, 0, N - 1);
   }
 
+  void start_pool_test(int *arr) {
+    LinkedList<int, PoolNodeAllocator> ll;
+    ll.reserve(N);
+
+    for (int i = 0; i < N; i++) {
+      ll.add(arr[i]);
+    }
+
+    ll.remove_at(0);
+    ll.add(arr[0], false);
+
+    LinkedList<int, PoolNodeAllocator> temp_ll(std::move(ll));
+    temp_ll.to_array(temp_arr);
+
+    test_results["pool allocator"] = check_arrays<int>(temp_arr, arr, N);
+  }
+
 private:
   int *temp_arr = nullptr;
   int N = 10;
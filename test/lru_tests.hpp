@@ -0,0 +1,129 @@
+#pragma once
+
+#include "lru.hpp"
+#include "sharded_lru.hpp"
+#include "test_utils.hpp"
+
+namespace pxd {
+class LRUCacheTests : public ITest {
+public:
+  void start_test() override {
+    start_get_test();
+    start_eviction_test();
+    start_recency_test();
+    start_update_test();
+    start_copy_ctor_test();
+    start_erase_test();
+    start_sharded_test();
+  }
+
+private:
+  void start_get_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i * 10);
+    }
+
+    test_results["get"] = lru.get(3) == 30 && lru.get(N - 1) == (N - 1) * 10;
+  }
+
+  void start_eviction_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N + 2; i++) {
+      lru.insert(i, i);
+    }
+
+    test_results["eviction"] = !lru.contains(0) && !lru.contains(1) &&
+                               lru.contains(2) &&
+                               lru.get_size() == static_cast<size_t>(N);
+  }
+
+  void start_recency_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i);
+    }
+
+    lru.get(0);
+    lru.insert(N, N);
+
+    test_results["recency"] = lru.contains(0) && !lru.contains(1);
+  }
+
+  void start_update_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i);
+    }
+
+    lru.insert(0, 123);
+    lru.insert(N, N);
+
+    test_results["update"] = lru.get(0) == 123 && !lru.contains(1) &&
+                             lru.get_size() == static_cast<size_t>(N);
+  }
+
+  void start_copy_ctor_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i);
+    }
+
+    LRUCache<int, int> temp(lru);
+    temp.get(0);
+    temp.insert(N, N);
+
+    test_results["copy ctor"] = temp.contains(0) && !temp.contains(1) &&
+                                lru.contains(1) && !lru.contains(N);
+  }
+
+  void start_erase_test() {
+    LRUCache<int, int> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i);
+    }
+
+    bool is_erased = lru.erase(0) && !lru.erase(0);
+    lru.insert(N, N);
+
+    test_results["erase"] = is_erased && lru.contains(1) && lru.contains(N);
+  }
+
+  void start_sharded_test() {
+    ShardedLRUCache<int, int, 4> lru(N);
+
+    for (int i = 0; i < N; i++) {
+      lru.insert(i, i);
+    }
+
+    int value = 0;
+    bool is_found = lru.try_get(5, value) && value == 5;
+    bool is_missed = !lru.try_get(N * 100, value);
+
+    LRUShardStats stats = lru.get_stats();
+
+    test_results["sharded get"] = is_found && is_missed && stats.hits == 1 &&
+                                  stats.misses == 1 &&
+                                  stats.size == static_cast<size_t>(N);
+
+    for (int i = N; i < N * 10; i++) {
+      lru.insert(i, i);
+    }
+
+    stats = lru.get_stats();
+
+    test_results["sharded eviction"] =
+        stats.size <= static_cast<size_t>(N * 4) &&
+        stats.size + stats.evictions == static_cast<size_t>(N * 10);
+  }
+
+private:
+  int N = 10;
+};
+} // namespace pxd
@@ -21,6 +21,11 @@ public:
     start_double_indexing_tests(temp_arr);
     start_parant_double_indexing_tests(temp_arr);
     start_transpose_tests(temp_arr);
+    start_non_square_transpose_tests();
+    start_element_wise_tests(temp_arr);
+    start_multiply_tests();
+    start_view_tests(temp_arr);
+    start_matrix_view_tests();
 
     delete[] temp_arr;
   }
@@ -113,6 +118,155 @@ private:
         check_arrays<int>(matrix.get_matrix().data(), transposed, 16);
   }
 
+  void start_non_square_transpose_tests() {
+    // wider than a transpose block to cross the block borders
+    constexpr int rows = 3;
+    constexpr int cols = 37;
+
+    Matrix<int, rows, cols> matrix;
+
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        matrix(i, j) = i * cols + j;
+      }
+    }
+
+    matrix.transpose();
+
+    bool is_valid = matrix.get_row() == cols && matrix.get_column() == rows;
+
+    for (int i = 0; i < cols && is_valid; i++) {
+      for (int j = 0; j < rows; j++) {
+        is_valid = is_valid && matrix(i, j) == j * cols + i;
+      }
+    }
+
+    matrix.transpose();
+
+    test_results["non square transpose"] = is_valid &&
+                                           matrix.get_row() == rows &&
+                                           matrix(2, 36) == 2 * cols + 36;
+  }
+
+  void start_element_wise_tests(int *temp_arr) {
+    Matrix<int, 4, 4> matrix(temp_arr);
+    Matrix<int, 4, 4> other(temp_arr);
+
+    Matrix<int, 4, 4> sum = matrix + other;
+    Matrix<int, 4, 4> diff = sum - matrix;
+    matrix *= 3;
+
+    bool is_valid = true;
+
+    for (int i = 0; i < N; i++) {
+      is_valid = is_valid && sum.get_ptr()[i] == temp_arr[i] * 2 &&
+                 diff.get_ptr()[i] == temp_arr[i] &&
+                 matrix.get_ptr()[i] == temp_arr[i] * 3;
+    }
+
+    test_results["element wise"] = is_valid;
+  }
+
+  void start_multiply_tests() {
+    // 6 x 9 by 9 x 11 leaves a row and a column remainder for every tile size
+    Matrix<float, 6, 9> left;
+    Matrix<float, 9, 11> right;
+
+    for (int i = 0; i < 6 * 9; i++) {
+      left.get_data()[i] = static_cast<float>(i % 7);
+    }
+
+    for (int i = 0; i < 9 * 11; i++) {
+      right.get_data()[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+
+    Matrix<float, 6, 11> product = left * right;
+
+    bool is_valid = true;
+
+    for (int i = 0; i < 6; i++) {
+      for (int j = 0; j < 11; j++) {
+        float expected = 0.0f;
+
+        for (int k = 0; k < 9; k++) {
+          expected += left(i, k) * right(k, j);
+        }
+
+        is_valid = is_valid && product(i, j) == expected;
+      }
+    }
+
+    Matrix<int, 4, 4> identity;
+
+    for (int i = 0; i < 16; i++) {
+      identity.get_data()[i] = i % 5 == 0 ? 1 : 0;
+    }
+
+    Matrix<int, 4, 4> square = identity * identity;
+
+    test_results["multiply"] =
+        is_valid &&
+        check_arrays<int>(identity.get_data(), square.get_data(), 16);
+  }
+
+  void start_view_tests(int *temp_arr) {
+    Matrix<int, 4, 4> matrix(temp_arr);
+
+    RowView<int> row = matrix[2];
+    row[1] = 100;
+    row[-1] = 200;
+
+    test_results["row view write through"] =
+        matrix(2, 1) == 100 && matrix(2, 3) == 200 &&
+        row.get_ptr() == matrix.get_ptr() + 8;
+
+    ColumnView<int> column = matrix.get_column_view(1);
+    int column_values[4];
+    column.to_array(column_values);
+
+    int expected_column[4] = {2, 6, 100, 14};
+
+    test_results["column view"] =
+        column.get_length() == 4 && column.get_stride() == 4 &&
+        check_arrays<int>(column_values, expected_column, 4);
+
+    const Matrix<int, 4, 4> &const_matrix = matrix;
+    int sum = 0;
+
+    for (const int value : const_matrix[0]) {
+      sum += value;
+    }
+
+    test_results["const row view"] = sum == 1 + 2 + 3 + 4;
+  }
+
+  void start_matrix_view_tests() {
+    // external memory, the view neither copies nor frees it
+    int buffer[6] = {1, 2, 3, 4, 5, 6};
+    int other_buffer[6] = {1, 1, 1, 1, 1, 1};
+    int transposed[6] = {};
+
+    MatrixView<int> view(buffer, 2, 3);
+    MatrixView<const int> other(other_buffer, 2, 3);
+
+    view.add(other);
+    view.scale(2);
+    view[1][0] = 0;
+
+    MatrixView<int> transposed_view(transposed, 3, 2);
+    view.transpose_to(transposed_view);
+
+    int expected[6] = {4, 6, 8, 0, 12, 14};
+    int expected_transposed[6] = {4, 0, 6, 12, 8, 14};
+
+    MatrixView<const int> const_view = view;
+
+    test_results["matrix view"] =
+        check_arrays<int>(buffer, expected, 6) &&
+        check_arrays<int>(transposed, expected_transposed, 6) &&
+        const_view(1, 2) == 14 && view.get_column_view(2)[1] == 14;
+  }
+
 private:
   int N = 16;
 };
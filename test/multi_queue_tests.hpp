@@ -0,0 +1,105 @@
+#pragma once
+
+#include "multi_queue.hpp"
+#include "test_utils.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+class MultiQueueTests : public ITest {
+public:
+  void start_test() override {
+    start_strict_pop_test();
+    start_relaxed_pop_test();
+    start_threads_test();
+  }
+
+private:
+  void start_strict_pop_test() {
+    MultiQueue<int, 4, false> queue(4);
+
+    for (int i = 0; i < 100; i++) {
+      queue.push((i * 37) % 100);
+    }
+
+    bool is_valid = queue.get_size() == 100;
+    int value = 0;
+
+    for (int i = 0; i < 100; i++) {
+      is_valid = is_valid && queue.pop(value) && value == i;
+    }
+
+    test_results["strict pop"] =
+        is_valid && !queue.pop(value) && queue.is_empty();
+  }
+
+  void start_relaxed_pop_test() {
+    MultiQueue<int> queue(8);
+
+    for (int i = 0; i < 1000; i++) {
+      queue.push(i);
+    }
+
+    // every value comes out once, the order is only close to the priority
+    std::vector<bool> is_popped(1000, false);
+    bool is_valid = true;
+    int value = 0;
+
+    for (int i = 0; i < 1000; i++) {
+      is_valid = is_valid && queue.try_pop(value) && !is_popped[value];
+      is_popped[value] = true;
+    }
+
+    test_results["relaxed pop"] = is_valid && !queue.try_pop(value);
+  }
+
+  void start_threads_test() {
+    constexpr int thread_count = 4;
+    constexpr int value_count = 20'000;
+
+    MultiQueue<int> queue(thread_count * 2);
+    std::atomic<long long> popped_sum = 0;
+    std::atomic<int> popped_count = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++) {
+      threads.emplace_back([&, t] {
+        long long sum = 0;
+        int count = 0;
+        int value = 0;
+
+        for (int i = t; i < value_count; i += thread_count) {
+          queue.push(i);
+
+          if (i % 2 == 0 && queue.try_pop(value)) {
+            sum += value;
+            count++;
+          }
+        }
+
+        popped_sum += sum;
+        popped_count += count;
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    long long sum = popped_sum;
+    int count = popped_count;
+    int value = 0;
+
+    while (queue.try_pop(value)) {
+      sum += value;
+      count++;
+    }
+
+    test_results["threads"] =
+        count == value_count &&
+        sum == static_cast<long long>(value_count) * (value_count - 1) / 2;
+  }
+};
+} // namespace pxd
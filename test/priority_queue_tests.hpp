@@ -1,8 +1,14 @@
 #pragma once
 
+#include "indexed_dheap.hpp"
 #include "priority_queue.hpp"
 #include "test_utils.hpp"
 
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace pxd {
 class PriorityQueueTests : public ITest
 {
@@ -18,6 +24,11 @@ public:
     start_top_test(temp_arr);
     start_update_test(temp_arr);
     start_remove_test(temp_arr);
+    start_heap_order_test();
+    start_indexed_heap_test();
+    start_indexed_heap_remove_test();
+    start_heap_batch_test();
+    start_queue_batch_test();
 
     delete[] temp_arr;
   }
@@ -73,6 +84,140 @@ private:
     test_results["remove"] = pq.peek() == 9;
   }
 
+  void start_heap_order_test()
+  {
+    DHeap<int, 4, true> heap;
+
+    for (int i = 0; i < 200; i++) {
+      heap.insert((i * 7919) % 1000);
+    }
+
+    for (int i = 0; i < 50; i++) {
+      heap.remove_at((i * 31) % static_cast<int>(heap.get_size()));
+    }
+
+    bool is_sorted = true;
+    int last_value = heap.top();
+
+    while (heap.get_size() > 0) {
+      int value = heap.top();
+      is_sorted = is_sorted && value <= last_value;
+      last_value = value;
+    }
+
+    test_results["heap order"] = is_sorted;
+  }
+
+  void start_indexed_heap_test()
+  {
+    IndexedDHeap<int, int, 4, false> heap;
+
+    for (int i = 0; i < 100; i++) {
+      heap.insert(i, 1000 - i);
+    }
+
+    // decrease key to the top, increase key of the current top
+    heap.update(42, -5);
+    heap.update(99, 5000);
+    heap.insert(7, -10);
+
+    bool is_valid = heap.peek().key == 7 && heap.get_priority(42) == -5 &&
+                    heap.get_size() == 100;
+
+    int last_priority = heap.peek().priority;
+
+    while (!heap.is_empty()) {
+      auto entry = heap.top();
+      is_valid = is_valid && entry.priority >= last_priority &&
+                 !heap.contains(entry.key);
+      last_priority = entry.priority;
+    }
+
+    test_results["indexed heap update"] = is_valid;
+  }
+
+  void start_indexed_heap_remove_test()
+  {
+    IndexedDHeap<int, int> heap;
+
+    for (int i = 0; i < 64; i++) {
+      heap.insert(i, (i * 37) % 64);
+    }
+
+    bool is_valid = true;
+
+    for (int i = 0; i < 64; i += 3) {
+      is_valid = is_valid && heap.remove(i);
+    }
+
+    is_valid = is_valid && !heap.remove(0) && heap.where(0) == -1;
+
+    // every remaining key is at its mapped position
+    for (int i = 0; i < static_cast<int>(heap.get_size()); i++) {
+      is_valid = is_valid && heap.where(heap[i].key) == i;
+    }
+
+    int last_priority = heap.peek().priority;
+
+    while (!heap.is_empty()) {
+      auto entry = heap.top();
+      is_valid = is_valid && entry.key % 3 != 0 &&
+                 entry.priority <= last_priority;
+      last_priority = entry.priority;
+    }
+
+    test_results["indexed heap remove"] = is_valid;
+  }
+
+  void start_heap_batch_test()
+  {
+    std::vector<int> range;
+
+    for (int i = 0; i < 1000; i++) {
+      range.push_back((i * 7919) % 1000);
+    }
+
+    DHeap<int, 4, true> heap;
+    heap.from_range(range.begin(), range.end());
+    heap.push_batch(range.begin(), range.begin() + 10);
+
+    std::vector<int> top_values = heap.pop_n(3);
+    std::vector<int> sorted_values = heap.pop_all_sorted();
+
+    bool is_sorted = sorted_values.size() == 1007 && heap.get_size() == 0;
+
+    for (size_t i = 1; i < sorted_values.size(); i++) {
+      is_sorted = is_sorted && sorted_values[i - 1] >= sorted_values[i];
+    }
+
+    test_results["heap from range"] =
+        top_values.size() == 3 && top_values[0] == 999 &&
+        top_values[1] == 998 && top_values[2] == 997 && is_sorted &&
+        sorted_values[0] == 996;
+  }
+
+  void start_queue_batch_test()
+  {
+    std::vector<std::pair<std::string, int>> jobs = {
+        {"c", 3}, {"a", 1}, {"e", 5}, {"b", 2}};
+
+    PriorityQueue<std::string, 4, false> pq;
+    pq.from_range(std::make_move_iterator(jobs.begin()),
+                  std::make_move_iterator(jobs.end()));
+
+    std::vector<std::pair<std::string, int>> more_jobs = {{"d", 4},
+                                                          {"f", 0}};
+    pq.push_batch(more_jobs.begin(), more_jobs.end());
+
+    std::vector<std::string> first = pq.pop_n(2);
+    std::vector<std::string> rest = pq.pop_all_sorted();
+
+    test_results["queue batch"] =
+        first == std::vector<std::string>{"f", "a"} &&
+        rest == std::vector<std::string>{"b", "c", "d", "e"} &&
+        more_jobs[0].first == "d" && pq.get_size() == 0;
+  }
+
 private:
   int N = 10;
 };
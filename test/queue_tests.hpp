@@ -23,6 +23,9 @@ public:
     start_push_test();
     start_pop_test(temp_arr);
     start_reverse_test(temp_arr, check_arr);
+    start_ring_test(temp_arr, check_arr);
+    start_ring_growth_test();
+    start_take_test(temp_arr, check_arr);
 
     delete[] check_arr;
     delete[] temp_arr;
@@ -95,6 +98,51 @@ private:
     test_results["reverse"] = check_reverse_arrays(temp_arr, check_arr, N);
   }
 
+  void start_ring_test(int *temp_arr, int *check_arr) {
+    RingQueue<int> queue(temp_arr, N);
+    RingQueue<int> q(queue);
+    q.to_array(check_arr);
+
+    bool is_valid = check_arrays(temp_arr, check_arr, N);
+    is_valid = is_valid && q.peek() == temp_arr[0] && q.pop() == temp_arr[0];
+    q.push(123);
+    is_valid = is_valid && q.get_length() == N;
+
+    test_results["ring"] = is_valid;
+  }
+
+  void start_ring_growth_test() {
+    RingQueue<int> queue;
+    bool is_valid = true;
+    int next_pop = 0;
+
+    // interleave so the head wraps around the buffer before every growth
+    for (int i = 0; i < N * 10; i++) {
+      queue.push(i);
+
+      if (i % 3 == 0) {
+        is_valid = is_valid && queue.pop() == next_pop++;
+      }
+    }
+
+    while (!queue.is_empty()) {
+      is_valid = is_valid && queue.pop() == next_pop++;
+    }
+
+    test_results["ring growth"] = is_valid && next_pop == N * 10;
+  }
+
+  void start_take_test(int *temp_arr, int *check_arr) {
+    RingQueue<int> queue(temp_arr, N);
+    bool is_valid = queue.get_queue_ref().get_length() == N;
+
+    DynamicRingBuffer<int> buffer = queue.take_queue();
+    buffer.to_array(check_arr);
+
+    test_results["take queue"] = is_valid && queue.is_empty() &&
+                                 check_arrays(temp_arr, check_arr, N);
+  }
+
 private:
   int N = 10;
 };
@@ -34,6 +34,14 @@ private:
     pxd::full_match(test_str, extract_regex, &s, &i);
 
     test_results["full match extract"] = s == "ruby" && i == 1234;
+
+    // the slice is matched with its length, the rest is not seen
+    const StringView slice = StringView(test_str).substr(0, 4);
+
+    test_results["full match view"] =
+        pxd::full_match(slice, RE2("\\w+")) &&
+        !pxd::full_match(slice, extract_regex) &&
+        pxd::partial_match(std::string("ruby:1234"), RE2("\\d{4}$"));
   }
 
   void start_partial_match_tests() {
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "ring_buffer.hpp"
+#include "test_utils.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace pxd {
+class RingBufferTests : public ITest {
+public:
+  void start_test() override {
+    start_spsc_push_pop_test();
+    start_spsc_full_test();
+    start_spsc_bulk_test();
+    start_spsc_threads_test();
+    start_mpmc_push_pop_test();
+    start_mpmc_full_test();
+    start_mpmc_threads_test();
+  }
+
+private:
+  void start_spsc_push_pop_test() {
+    SPSCRingBuffer<int, 8> buffer;
+    int value = 0;
+
+    bool is_valid = !buffer.try_pop(value);
+
+    // wrap around the buffer a few times
+    for (int i = 0; i < 20; i++) {
+      is_valid = is_valid && buffer.try_push(i) && buffer.try_pop(value) &&
+                 value == i;
+    }
+
+    test_results["spsc push pop"] = is_valid && buffer.is_empty();
+  }
+
+  void start_spsc_full_test() {
+    SPSCRingBuffer<int, 8> buffer;
+    bool is_valid = true;
+
+    for (int i = 0; i < 8; i++) {
+      is_valid = is_valid && buffer.try_push(i);
+    }
+
+    test_results["spsc full"] =
+        is_valid && !buffer.try_push(8) && buffer.get_size() == 8;
+  }
+
+  void start_spsc_bulk_test() {
+    SPSCRingBuffer<int, 8> buffer;
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int check_values[10] = {};
+
+    bool is_valid = buffer.push_n(values, 3) == 3;
+    is_valid = is_valid && buffer.pop_n(check_values, 2) == 2;
+    // 1 value is left, only 7 of the 10 values fit
+    is_valid = is_valid && buffer.push_n(values + 3, 7) == 7;
+    is_valid = is_valid && buffer.push_n(values, 1) == 0;
+    is_valid = is_valid && buffer.pop_n(check_values + 2, 10) == 8;
+
+    test_results["spsc bulk"] =
+        is_valid && check_arrays(values, check_values, 10);
+  }
+
+  void start_spsc_threads_test() {
+    SPSCRingBuffer<int, 64> buffer;
+
+    std::thread producer([&buffer, this] {
+      for (int i = 0; i < thread_value_count; i++) {
+        while (!buffer.try_push(i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    bool is_valid = true;
+
+    for (int i = 0; i < thread_value_count; i++) {
+      int value = -1;
+
+      while (!buffer.try_pop(value)) {
+        std::this_thread::yield();
+      }
+
+      is_valid = is_valid && value == i;
+    }
+
+    producer.join();
+
+    test_results["spsc threads"] = is_valid;
+  }
+
+  void start_mpmc_push_pop_test() {
+    MPMCRingBuffer<int, 8> buffer;
+    int value = 0;
+
+    bool is_valid = !buffer.try_pop(value);
+
+    for (int i = 0; i < 20; i++) {
+      is_valid = is_valid && buffer.try_push(i) && buffer.try_pop(value) &&
+                 value == i;
+    }
+
+    test_results["mpmc push pop"] = is_valid && buffer.is_empty();
+  }
+
+  void start_mpmc_full_test() {
+    MPMCRingBuffer<int, 8> buffer;
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int check_values[10] = {};
+
+    bool is_valid = buffer.push_n(values, 10) == 8 && !buffer.try_push(8);
+    is_valid = is_valid && buffer.pop_n(check_values, 10) == 8;
+
+    test_results["mpmc full"] =
+        is_valid && check_arrays(values, check_values, 8);
+  }
+
+  /// @brief every value has to be popped exactly once
+  void start_mpmc_threads_test() {
+    constexpr int thread_count = 4;
+
+    MPMCRingBuffer<int, 64> buffer;
+    std::atomic<long long> popped_sum = 0;
+    std::atomic<int> popped_count = 0;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; t++) {
+      threads.emplace_back([&buffer, t, this] {
+        for (int i = t; i < thread_value_count; i += thread_count) {
+          while (!buffer.try_push(i)) {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      threads.emplace_back([&buffer, &popped_sum, &popped_count, this] {
+        int value = 0;
+
+        while (popped_count.load() < thread_value_count) {
+          if (buffer.try_pop(value)) {
+            popped_sum += value;
+            popped_count++;
+          } else {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    const long long expected_sum =
+        static_cast<long long>(thread_value_count - 1) * thread_value_count / 2;
+
+    test_results["mpmc threads"] = popped_count == thread_value_count &&
+                                   popped_sum == expected_sum &&
+                                   buffer.is_empty();
+  }
+
+private:
+  int thread_value_count = 100'000;
+};
+} // namespace pxd
@@ -23,6 +23,9 @@ public:
     start_push_test();
     start_pop_test(temp_arr);
     start_reverse_test(temp_arr, check_arr);
+    start_ring_test(temp_arr, check_arr);
+    start_ring_growth_test();
+    start_take_test(temp_arr, check_arr);
 
     delete[] check_arr;
     delete[] temp_arr;
@@ -99,6 +102,46 @@ private:
     test_results["reverse"] = check_arrays(temp_arr, check_arr, N);
   }
 
+  void start_ring_test(int *temp_arr, int *check_arr) {
+    RingStack<int> stack(temp_arr, N);
+    RingStack<int> st(stack);
+    st.to_array(check_arr);
+
+    bool is_valid = check_reverse_arrays(temp_arr, check_arr, N);
+    is_valid =
+        is_valid && st.peek() == temp_arr[N - 1] && st.pop() == temp_arr[N - 1];
+    st.push(123);
+    is_valid = is_valid && st.peek() == 123 && st.get_length() == N;
+
+    test_results["ring"] = is_valid;
+  }
+
+  void start_ring_growth_test() {
+    RingStack<int> stack;
+    bool is_valid = true;
+
+    for (int i = 0; i < N * 10; i++) {
+      stack.push(i);
+    }
+
+    for (int i = N * 10 - 1; i >= 0; i--) {
+      is_valid = is_valid && stack.pop() == i;
+    }
+
+    test_results["ring growth"] = is_valid && stack.is_empty();
+  }
+
+  void start_take_test(int *temp_arr, int *check_arr) {
+    RingStack<int> stack(temp_arr, N);
+    bool is_valid = stack.get_stack_ref().get_length() == N;
+
+    DynamicRingBuffer<int> buffer = stack.take_stack();
+    buffer.to_array(check_arr);
+
+    test_results["take stack"] = is_valid && stack.is_empty() &&
+                                 check_reverse_arrays(temp_arr, check_arr, N);
+  }
+
 private:
   int N = 10;
 };
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "absl/hash.hpp"
+#include "absl/str_cat.hpp"
+#include "absl/str_replace.hpp"
+#include "absl/str_split.hpp"
+#include "string.hpp"
+#include "test_utils.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace pxd {
+class StringTests : public ITest {
+public:
+  void start_test() override {
+    start_inline_tests();
+    start_copy_move_tests();
+    start_append_tests();
+#ifndef PXD_USE_STD_STRING
+    // the std::string value does not use the allocator
+    start_arena_tests();
+#endif
+    start_view_tests();
+    start_replace_many_tests();
+    start_search_tests();
+    start_split_tests();
+    start_builder_tests();
+  }
+
+private:
+  void start_inline_tests() {
+    String short_str("short key");
+    String long_str("a key which is longer than the inline capacity");
+
+    test_results["inline"] =
+        short_str.is_inline() && short_str.length() == 9 &&
+        short_str == "short key" && !long_str.is_inline() &&
+        long_str.length() == 46 && long_str == std::string(long_str.c_str());
+
+    String empty_str;
+
+    test_results["empty"] = empty_str.is_empty() &&
+                            empty_str.c_str()[0] == '\0' &&
+                            empty_str == "";
+  }
+
+  void start_copy_move_tests() {
+    // the copies use the length, the null in the middle is kept
+    const char chars[] = "key\0with null, longer than the inline capacity";
+    String str(chars, sizeof(chars) - 1);
+    String copy(str);
+    String assigned;
+    assigned = str;
+
+    test_results["copy keeps length"] = copy.length() == sizeof(chars) - 1 &&
+                                        copy == str && assigned == str &&
+                                        copy.c_str() != str.c_str();
+
+    const char *buffer = str.c_str();
+    String moved(std::move(str));
+    String short_moved(String("short"));
+
+    test_results["move"] = moved.c_str() == buffer && str.is_empty() &&
+                           str.is_inline() && short_moved == "short";
+  }
+
+  void start_append_tests() {
+    String str("key");
+    str += ":";
+    str += std::string("part");
+
+    const bool is_inline_append = str == "key:part" && str.is_inline();
+
+    for (int i = 0; i < 10; i++) {
+      str += String("-0123456789");
+    }
+
+    // the value of the string itself is appended
+    str.append(str.c_str(), 3);
+
+    String concat = String("left ") + "right";
+
+    test_results["append"] = is_inline_append && str.length() == 121 &&
+                             str.string_view().substr(116) == "89key" &&
+                             concat == "left right";
+
+    str.clear();
+
+    test_results["clear"] = str.is_empty() && !str.is_inline() &&
+                            str == String();
+  }
+
+  void start_arena_tests() {
+    StringArena arena(1024);
+
+    {
+      String str(&arena);
+      str = "a long enough value to be allocated from the arena";
+
+      String big_str(std::string(2000, 'x').c_str(), 2000, &arena);
+      String copy(str);
+
+      test_results["arena"] =
+          str.get_allocator() == &arena && !str.is_inline() &&
+          arena.get_used_size() >= 2000 + str.capacity() &&
+          copy.get_allocator() == nullptr && copy == str &&
+          big_str.length() == 2000;
+    }
+
+    arena.reset();
+    const bool is_reset = arena.get_used_size() == 0;
+    bool is_valid_reuse = false;
+
+    {
+      String str("a value which reuses the first block of the arena", 49,
+                 &arena);
+      is_valid_reuse = str.length() == 49 && arena.get_used_size() == 56;
+    }
+
+    arena.release();
+
+    test_results["arena reset release"] =
+        is_reset && is_valid_reuse && arena.get_used_size() == 0;
+  }
+
+  void start_view_tests() {
+    String str("key:value, longer than the inline capacity");
+    const std::string std_str = "key:value";
+
+    // the views point to the chars of the strings, not to copies
+    const StringView view = str;
+    const StringView std_view = std_str;
+    const StringView key = view.substr(0, 3);
+    const StringView rest = view.substr(4);
+
+    test_results["string view"] =
+        view.data() == str.data() && view.length() == str.length() &&
+        std_view.data() == std_str.data() && key == "key" &&
+        key.length() == 3 && rest.starts_with("value") &&
+        rest.ends_with("capacity") && view.substr(100).is_empty() &&
+        std_view == view.substr(0, 9) && key != std_view;
+
+    String copy(key);
+    copy.append(rest.substr(0, 6));
+
+    test_results["string view copy"] =
+        copy == "keyvalue," && copy.data() != key.data() &&
+        absl::HashOf(key) == absl::HashOf(StringView("key"));
+  }
+
+  void start_replace_many_tests() {
+    String str("the cat sat on the mat");
+    str.replace_many({{"cat", "dog"}, {"mat", "rug"}, {"the ", ""}});
+
+    String unchanged("no needle here");
+    const char *buffer = unchanged.data();
+    unchanged.replace_many({{"", "x"}, {"cat", "dog"}});
+
+    test_results["replace many"] = str == "dog sat on rug" &&
+                                   unchanged == "no needle here" &&
+                                   unchanged.data() == buffer;
+
+    // the leftmost needle wins, then the longest one starting there, like
+    // absl::StrReplaceAll
+    const std::vector<std::pair<std::string, StringReplacements>> cases = {
+        {"ushers", {{"he", "H"}, {"she", "S"}, {"hers", "X"}}},
+        {"abcd", {{"abcd", "X"}, {"bc", "Y"}}},
+        {"abcd", {{"cd", "2"}, {"bcd", "1"}}},
+        {"abcx abcd ab", {{"ab", "1"}, {"abcd", "2"}}},
+        {"aaaa", {{"aa", "1"}, {"aaa", "2"}}},
+        {"xabcabcy", {{"abcabd", "1"}, {"bca", "2"}, {"c", "3"}}}};
+    const std::vector<std::string> expected = {"uSrs",    "X",  "a1",
+                                               "1cx 2 1", "2a", "xa2b3y"};
+    bool is_absl_equal = true;
+    bool is_expected = true;
+
+    for (std::size_t i = 0; i < cases.size(); i++) {
+      const auto &[input, pairs] = cases[i];
+      std::vector<std::pair<std::string, std::string>> std_pairs;
+
+      for (const auto &[needle, replacement] : pairs) {
+        std_pairs.emplace_back(needle.string(), replacement.string());
+      }
+
+      String str(input);
+      str.replace_many(pairs);
+
+      is_expected = is_expected && str == expected[i];
+      is_absl_equal =
+          is_absl_equal && str == absl::StrReplaceAll(input, std_pairs);
+    }
+
+    test_results["replace many overlap"] = is_expected && is_absl_equal;
+
+    // the output is sized once, then its buffer is reused
+    StringReplacer replacer({{"a", "bb"}, {"secret", "***"}});
+    String output;
+    const std::size_t grow_count =
+        replacer.replace(std::string(30, 'a'), output);
+    const bool is_exact = output.length() == 60 && output.capacity() == 60;
+
+    buffer = output.data();
+    const std::size_t reuse_count =
+        replacer.replace("key=secret; token=secret", output);
+
+    test_results["replace many output"] =
+        is_exact && grow_count == 30 && reuse_count == 2 &&
+        output == "key=***; token=***" && output.data() == buffer &&
+        replacer.get_needle_count() == 2;
+  }
+
+  void start_search_tests() {
+    // a small alphabet has many candidates, the lengths cross the 16, 32 and
+    // 64 char blocks of the simd loops
+    std::string text;
+
+    for (int i = 0; i < 300; i++) {
+      text += static_cast<char>('a' + (i * 7 + i / 5) % 3);
+    }
+
+    const std::string_view std_view = text;
+    const String str(text);
+    bool is_find_valid = true;
+    bool is_rfind_valid = true;
+    bool is_count_valid = true;
+
+    for (const char *needle : {"a", "c", "d", "ab", "cab", "abca", "bcbca"}) {
+      for (std::size_t index : {0, 1, 15, 31, 63, 100, 250, 299, 300, 400}) {
+        is_find_valid = is_find_valid &&
+                        str.find(needle, index) == std_view.find(needle, index);
+        is_rfind_valid =
+            is_rfind_valid &&
+            str.rfind(needle, index) == std_view.rfind(needle, index);
+      }
+
+      std::size_t std_count = 0;
+
+      for (std::size_t index = std_view.find(needle);
+           index != std::string_view::npos;
+           index = std_view.find(needle, index + strlen(needle))) {
+        std_count++;
+      }
+
+      is_count_valid = is_count_valid && str.count(needle) == std_count;
+    }
+
+    test_results["find"] = is_find_valid && str.find('b', 2) == 4 &&
+                           str.find("") == 0 &&
+                           str.find(std::string(301, 'a')) == StringView::npos;
+    test_results["rfind"] = is_rfind_valid && str.rfind('a') == 298 &&
+                            str.rfind("") == 300 && String().rfind('a') ==
+                                                        StringView::npos;
+    test_results["count"] = is_count_valid && str.count('a') == 120 &&
+                            StringView("aaaa").count("aa") == 2 &&
+                            str.count("") == 0;
+  }
+
+  void start_split_tests() {
+    std::string line;
+
+    for (int i = 0; i < 100; i++) {
+      line += i % 7 == 0 ? "," : std::to_string(i);
+      line += ',';
+    }
+
+    const String str(line);
+    const std::vector<std::string> expected = absl::StrSplit(line, ',');
+    std::vector<std::string> tokens;
+
+    for (StringView token : str.split(',')) {
+      tokens.push_back(token.string());
+    }
+
+    // the tokens are views of the string
+    const bool is_view = str.split(',').begin()->data() == str.data();
+
+    std::vector<std::string> multi_tokens;
+
+    for (StringView token : StringView("a::b::::c::").split("::")) {
+      multi_tokens.push_back(token.string());
+    }
+
+    int empty_count = 0;
+
+    for (StringView token : String().split(',')) {
+      empty_count += token.is_empty();
+    }
+
+    int no_split_count = 0;
+
+    for (StringView token : StringView("a,b").split("")) {
+      no_split_count += token == "a,b";
+    }
+
+    test_results["split"] = tokens == expected && is_view;
+    test_results["split delimiters"] =
+        multi_tokens ==
+            std::vector<std::string>{"a", "b", "", "c", ""} &&
+        empty_count == 1 && no_split_count == 1;
+  }
+
+  void start_builder_tests() {
+    const String key = str::concat(
+        "user:", 42, ':', -7, ':', 2.5, std::string(":s"), String(":t"),
+        StringView("::u").substr(1), absl::Hex(255),
+        std::numeric_limits<std::int64_t>::min());
+
+    test_results["concat"] =
+        key == "user:42:-7:2.5:s:t:uff-9223372036854775808" &&
+        key.capacity() == key.length();
+
+    String dest("id=");
+    str::append(dest, 1234567890123ULL, ", ", 0.1f);
+
+    test_results["concat append"] = dest == "id=1234567890123, 0.1";
+
+    StringBuilder builder;
+    builder.append("session:", 99).append_format(":{:04d}:{}", 7, "x");
+    const String built = builder.build();
+
+    // the buffer is kept after the clear
+    const char *buffer = builder.view().data();
+    builder.clear();
+    builder.append(String("a value which is longer than the inline one"));
+
+    test_results["builder"] = built == "session:99:0007:x" &&
+                              builder.view().data() == buffer &&
+                              builder.length() == 43 &&
+                              builder.build().capacity() == 43;
+  }
+};
+} // namespace pxd
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "test_utils.hpp"
+#include "thread_pool.hpp"
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace pxd {
+class TopKTests : public ITest {
+public:
+  void start_test() override {
+    start_streaming_tests();
+    start_merge_tests();
+    start_select_tests();
+    start_parallel_tests();
+  }
+
+private:
+  /// @brief shuffled values with duplicates
+  static auto make_values(int size) -> std::vector<int> {
+    std::vector<int> values(size);
+
+    for (int i = 0; i < size; i++) {
+      values[i] = (i * 7919) % (size / 2 + 1);
+    }
+
+    return values;
+  }
+
+  static auto get_expected(std::vector<int> values, int k)
+      -> std::vector<int> {
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    values.resize(std::min<size_t>(k, values.size()));
+
+    return values;
+  }
+
+  void start_streaming_tests() {
+    std::vector<int> values = make_values(1000);
+    TopK<int> accumulator(10);
+
+    // fed in the uneven chunks
+    accumulator.push_range(values.data(), 3);
+    accumulator.push_range(values.data() + 3, 500);
+
+    for (int i = 503; i < 1000; i++) {
+      accumulator.push(values[i]);
+    }
+
+    std::vector<int> expected = get_expected(values, 10);
+
+    test_results["streaming"] = accumulator.get_sorted() == expected &&
+                                accumulator.get_threshold() == expected[9];
+
+    accumulator.reset();
+    accumulator.push_range(values.data(), 5);
+
+    TopK<int> empty_accumulator(0);
+    empty_accumulator.push_range(values.data(), 1000);
+
+    test_results["reset and small input"] =
+        accumulator.get_sorted() ==
+            get_expected(std::vector<int>(values.begin(), values.begin() + 5),
+                         10) &&
+        !accumulator.is_full() && empty_accumulator.get_size() == 0;
+
+    // the threshold of an empty or a just filled heap is not read
+    TopK<int> fresh_accumulator(5);
+    fresh_accumulator.push_range(values.data(), 0);
+    const bool is_empty_valid = fresh_accumulator.get_size() == 0;
+    fresh_accumulator.push_range(values.data(), 5);
+
+    test_results["empty input"] =
+        is_empty_valid && top_k(values.data(), 0, 5).empty() &&
+        fresh_accumulator.is_full() &&
+        fresh_accumulator.get_sorted() ==
+            get_expected(std::vector<int>(values.begin(), values.begin() + 5),
+                         5);
+  }
+
+  void start_merge_tests() {
+    std::vector<int> values = make_values(2000);
+    TopK<int> first(50);
+    TopK<int> second(50);
+
+    first.push_range(values.data(), 1200);
+    second.push_range(values.data() + 1200, 800);
+    first.merge(second);
+
+    test_results["merge"] = first.get_sorted() == get_expected(values, 50);
+  }
+
+  void start_select_tests() {
+    std::vector<int> values = make_values(1000);
+    std::vector<int> selected = values;
+    const int count = top_k_select(selected.data(), 1000, 100);
+    selected.resize(count);
+
+    test_results["select in place"] = selected == get_expected(values, 100);
+    test_results["select algorithm"] =
+        top_k(values.data(), 1000, 100, eTOP_K_ALGORITHM::SELECT) ==
+            get_expected(values, 100) &&
+        top_k(values.data(), 1000, 2000, eTOP_K_ALGORITHM::SELECT) ==
+            get_expected(values, 2000) &&
+        top_k(values.data(), 1000, 2000) == get_expected(values, 2000);
+  }
+
+  void start_parallel_tests() {
+    std::vector<int> values = make_values(PXD_TOP_K_PARALLEL_MIN_SIZE * 4);
+    const int size = static_cast<int>(values.size());
+    ThreadPool thread_pool(4);
+
+    test_results["parallel"] =
+        parallel_top_k(values.data(), size, 100, thread_pool) ==
+            get_expected(values, 100) &&
+        parallel_top_k(values.data(), size, 100'000, thread_pool) ==
+            get_expected(values, 100'000);
+  }
+};
+} // namespace pxd
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "node_allocator.hpp"
+#include "randomized_treap.hpp"
+#include "test_utils.hpp"
+#include "treap.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace pxd {
+/// @brief pool allocator which counts the allocations that need a new chunk
+template <typename Node>
+class CountingPoolAllocator : public PoolNodeAllocator<Node> {
+public:
+  auto allocate() -> Node * {
+    if (this->get_free_count() == 0) {
+      chunk_count++;
+    }
+
+    return PoolNodeAllocator<Node>::allocate();
+  }
+
+  static inline int chunk_count = 0;
+};
+
+class TreapTests : public ITest {
+public:
+  void start_test() override {
+    start_insert_remove_tests();
+    start_split_join_tests();
+    start_order_statistic_tests();
+    start_from_sorted_tests();
+    start_copy_move_tests();
+    start_pool_allocator_tests();
+  }
+
+private:
+  /// @brief the keys 0, 1, ..., size - 1 inserted in a shuffled order
+  static auto make_treap(int size) -> RandomizedTreap<int> {
+    RandomizedTreap<int> treap;
+
+    for (int i = 0; i < size; i++) {
+      treap.insert((i * 7) % size);
+    }
+
+    return treap;
+  }
+
+  template <template <typename> class NodeAllocator>
+  static auto check_keys(const RandomizedTreap<int, NodeAllocator> &treap,
+                         int first, int last) -> bool {
+    bool is_valid = treap.get_size() == last - first;
+
+    for (int i = 0; i < last - first && is_valid; i++) {
+      is_valid = treap.kth(i) == first + i;
+    }
+
+    return is_valid;
+  }
+
+  void start_insert_remove_tests() {
+    Treap<int> treap;
+    int keys[5] = {5, 2, 8, 1, 9};
+    double priorities[5] = {0.5, 0.1, 0.9, 0.3, 0.2};
+
+    for (int i = 0; i < 5; i++) {
+      treap.insert(keys[i], priorities[i]);
+    }
+
+    test_results["insert"] = treap.peek() == 2 && treap.min() == 1 &&
+                             treap.max() == 9 && treap.get_size() == 5 &&
+                             treap.contains(8) && !treap.contains(3);
+
+    const bool is_removed = treap.remove(2) && !treap.remove(3);
+    const int top_key = treap.top();
+
+    test_results["remove and top"] = is_removed && top_key == 9 &&
+                                     treap.get_size() == 3 &&
+                                     !treap.contains(2) && treap.peek() == 1;
+  }
+
+  void start_split_join_tests() {
+    RandomizedTreap<int> treap = make_treap(100);
+    RandomizedTreap<int> right = treap.split(40);
+
+    const bool is_split =
+        check_keys(treap, 0, 40) && check_keys(right, 40, 100);
+
+    treap.join(std::move(right));
+
+    test_results["split join"] = is_split && check_keys(treap, 0, 100) &&
+                                 right.is_empty();
+  }
+
+  void start_order_statistic_tests() {
+    RandomizedTreap<int> treap;
+
+    for (int i = 0; i < 50; i++) {
+      treap.insert(i * 2);
+    }
+
+    test_results["kth rank"] = treap.kth(0) == 0 && treap.kth(49) == 98 &&
+                               treap.rank(0) == 0 && treap.rank(11) == 6 &&
+                               treap.rank(12) == 6 && treap.rank(1000) == 50;
+
+    std::vector<int> expected = {10, 12, 14, 16};
+
+    test_results["range query"] = treap.range_query(9, 17) == expected &&
+                                  treap.range_count(10, 16) == 4 &&
+                                  treap.range_count(16, 10) == 0 &&
+                                  treap.range_query(99, 200).empty();
+  }
+
+  void start_from_sorted_tests() {
+    std::vector<int> keys(1000);
+
+    for (int i = 0; i < 1000; i++) {
+      keys[i] = i;
+    }
+
+    RandomizedTreap<int> treap;
+    treap.from_sorted(keys.data(), 1000);
+    treap.insert(1000);
+    treap.remove(0);
+
+    // the ascending priorities make a list, the release has to handle it
+    std::vector<double> priorities(1000);
+
+    for (int i = 0; i < 1000; i++) {
+      priorities[i] = i;
+    }
+
+    Treap<int> list_treap;
+    list_treap.from_sorted(keys.data(), priorities.data(), 1000);
+
+    test_results["from sorted"] = check_keys(treap, 1, 1001) &&
+                                  list_treap.peek() == 0 &&
+                                  list_treap.kth(999) == 999 &&
+                                  list_treap.rank(500) == 500;
+
+    // a long list is deeper than the call stack, the copy, the split, the
+    // join and the range query have to walk it without the recursion
+    const int list_size = 1'000'000;
+    keys.resize(list_size);
+    priorities.resize(list_size);
+
+    for (int i = 0; i < list_size; i++) {
+      keys[i] = i;
+      priorities[i] = i;
+    }
+
+    Treap<int> long_list;
+    long_list.from_sorted(keys.data(), priorities.data(), list_size);
+
+    Treap<int> list_copy(long_list);
+    Treap<int> right_half = list_copy.split(list_size / 2);
+    const bool is_split = list_copy.get_size() == list_size / 2 &&
+                          list_copy.max() == list_size / 2 - 1 &&
+                          right_half.get_size() == list_size / 2 &&
+                          right_half.min() == list_size / 2;
+
+    list_copy.join(std::move(right_half));
+
+    test_results["long list"] =
+        is_split && list_copy.get_size() == list_size &&
+        list_copy.kth(list_size - 1) == list_size - 1 &&
+        list_copy.range_count(0, list_size) == list_size &&
+        list_copy.range_query(list_size - 3, list_size).size() == 3 &&
+        long_list.get_size() == list_size;
+  }
+
+  void start_copy_move_tests() {
+    RandomizedTreap<int> treap = make_treap(20);
+    RandomizedTreap<int> copy(treap);
+    copy.remove(5);
+
+    RandomizedTreap<int> moved(std::move(copy));
+
+    test_results["copy move"] = check_keys(treap, 0, 20) &&
+                                moved.get_size() == 19 && !moved.contains(5) &&
+                                copy.is_empty();
+  }
+
+  void start_pool_allocator_tests() {
+    RandomizedTreap<int, PoolNodeAllocator> treap;
+    treap.reserve(100);
+
+    for (int i = 0; i < 100; i++) {
+      treap.insert((i * 7) % 100);
+    }
+
+    // the removed nodes are recycled by the inserts
+    for (int i = 0; i < 100; i += 2) {
+      treap.remove(i);
+    }
+
+    for (int i = 0; i < 100; i += 2) {
+      treap.insert(i);
+    }
+
+    test_results["pool allocator"] = check_keys(treap, 0, 100);
+
+    // the moved keys are copied to the pool of the right treap and the join
+    // takes over the pool of the other treap
+    RandomizedTreap<int, PoolNodeAllocator> right = treap.split(40);
+    const bool is_split =
+        check_keys(treap, 0, 40) && check_keys(right, 40, 100);
+
+    right.remove(50);
+    treap.join(std::move(right));
+    treap.insert(50);
+
+    RandomizedTreap<int, PoolNodeAllocator> copy(treap);
+    treap.release();
+    treap.insert(1);
+
+    test_results["pool allocator split join"] =
+        is_split && check_keys(copy, 0, 100) && right.is_empty() &&
+        treap.get_size() == 1 && treap.contains(1);
+
+    // the build from the sorted keys starts with a release, it has to keep
+    // the reserved nodes
+    std::vector<int> keys(100);
+    std::vector<double> priorities(100);
+
+    for (int i = 0; i < 100; i++) {
+      keys[i] = i;
+      priorities[i] = (i * 37) % 100;
+    }
+
+    Treap<int, CountingPoolAllocator> reserved_treap;
+    reserved_treap.reserve(100);
+    CountingPoolAllocator<TreapNode<int>>::chunk_count = 0;
+    reserved_treap.from_sorted(keys.data(), priorities.data(), 100);
+
+    test_results["pool allocator reserve"] =
+        CountingPoolAllocator<TreapNode<int>>::chunk_count == 0 &&
+        reserved_treap.get_size() == 100 && reserved_treap.kth(99) == 99 &&
+        reserved_treap.rank(50) == 50;
+  }
+};
+} // namespace pxd
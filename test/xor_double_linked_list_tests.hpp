@@ -21,6 +21,7 @@ public:
     start_move_ctor_test(temp_arr, check_arr);
     start_index_test(temp_arr);
     start_remove_test(temp_arr);
+    start_pool_test(temp_arr, check_arr);
 
     delete[] temp_arr;
     delete[] check_arr;
@@ -95,6 +96,18 @@ private:
     test_results["remove end"] = xdll[6] == 9;
   }
 
+  void start_pool_test(int *temp_arr, int *check_arr) {
+    XORDoubleLinkedList<int, PoolNodeAllocator> xdll;
+    xdll.reserve(N);
+    xdll.from_array(temp_arr, N);
+
+    XORDoubleLinkedList<int, PoolNodeAllocator> temp_xdll;
+    temp_xdll = std::move(xdll);
+    temp_xdll.to_array(check_arr);
+
+    test_results["pool allocator"] = check_arrays<int>(temp_arr, check_arr, N);
+  }
+
 private:
   int N = 10;
 };